@@ -20,6 +20,21 @@
 uint32_t g_test_count = 1;
 void crypto_common_exit_action(void);
 
+extern val_api_t *val;
+
+/* Keys handed out by crypto_fixture_import_key, looked up by a hash of the import request */
+typedef struct {
+    uint32_t      hash;
+    psa_key_id_t  key;
+    bool_t        persistent;
+} crypto_fixture_t;
+
+static crypto_fixture_t g_crypto_fixture[CRYPTO_FIXTURE_SLOTS];
+static uint32_t         g_crypto_fixture_count;
+#ifdef CRYPTO_KEY_FIXTURES
+static uint8_t          g_crypto_fixture_export[2][BUFFER_SIZE];
+#endif
+
 const uint8_t key_data[] = {
  0x01, 0x03, 0x0E, 0x0F, 0x1F, 0x3F, 0xEF, 0XFF,
  0x02, 0x0A, 0x2A, 0xAA, 0x04, 0x24, 0x88, 0x03,
@@ -489,8 +504,286 @@ const uint8_t input_label[INPUT_LABEL_LEN]             = "Label";
 /* output buffers */
 uint8_t expected_output[BUFFER_SIZE];
 
+/**
+    @brief    - FNV-1a hash of a buffer, chained through hash
+    @param    - hash   : Hash of the preceding buffers
+                data   : Buffer to hash
+                length : Buffer length in bytes
+    @return   - Updated hash
+**/
+static uint32_t crypto_fixture_hash(uint32_t hash, const void *data, size_t length)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    size_t         i;
+
+    for (i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+#ifdef CRYPTO_KEY_FIXTURES
+/**
+    @brief    - Check that the key stored under key_id holds the requested key material.
+                Public keys and exportable keys are exported and compared. A key pair that
+                may not be exported is compared by its public part, against a volatile copy
+                of the requested material.
+    @param    - attributes : Requested attributes, lifetime and ID not set
+                data       : Key material
+                data_length: Key material length
+                key_id     : Stored key
+                same       : Returns TRUE if the material matches
+    @return   - PSA status
+**/
+static int32_t crypto_fixture_same_material(psa_key_attributes_t *attributes,
+                                            const uint8_t *data, size_t data_length,
+                                            psa_key_id_t key_id, bool_t *same)
+{
+    psa_key_type_t        type;
+    psa_key_usage_t       usage;
+    psa_key_id_t          copy;
+    size_t                length, copy_length;
+    int32_t               status;
+
+    *same = FALSE;
+    val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, attributes, &type);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, attributes, &usage);
+
+    if (PSA_KEY_TYPE_IS_PUBLIC_KEY(type) || (usage & PSA_KEY_USAGE_EXPORT))
+    {
+        status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key_id, g_crypto_fixture_export[0],
+                                      sizeof(g_crypto_fixture_export[0]), &length);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+        *same = ((length == data_length) &&
+                 (memcmp(g_crypto_fixture_export[0], data, length) == 0)) ? TRUE : FALSE;
+        return PSA_SUCCESS;
+    }
+
+    status = val->crypto_function(VAL_CRYPTO_EXPORT_PUBLIC_KEY, key_id,
+                                  g_crypto_fixture_export[0],
+                                  sizeof(g_crypto_fixture_export[0]), &length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, data, data_length, &copy);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    status = val->crypto_function(VAL_CRYPTO_EXPORT_PUBLIC_KEY, copy,
+                                  g_crypto_fixture_export[1],
+                                  sizeof(g_crypto_fixture_export[1]), &copy_length);
+    val->crypto_function(VAL_CRYPTO_DESTROY_KEY, copy);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    *same = ((length == copy_length) &&
+             (memcmp(g_crypto_fixture_export[0], g_crypto_fixture_export[1], length) == 0))
+            ? TRUE : FALSE;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Open the persistent fixture key stored under key_id by an earlier test or
+                run, or import it there. The request hash selects key_id, but only 20 bits
+                of it, so a stored key is reused only if its type, size, policy and key
+                material all match the request.
+    @param    - attributes : Requested attributes, lifetime and ID not set
+                data       : Key material
+                data_length: Key material length
+                key_id     : Reserved persistent key ID
+    @return   - PSA status
+**/
+static int32_t crypto_fixture_persistent_key(psa_key_attributes_t *attributes,
+                                             const uint8_t *data, size_t data_length,
+                                             psa_key_id_t key_id)
+{
+    psa_key_attributes_t  stored = PSA_KEY_ATTRIBUTES_INIT;
+    psa_key_type_t        type, stored_type;
+    psa_key_usage_t       usage, stored_usage;
+    psa_algorithm_t       alg, stored_alg;
+    size_t                bits, stored_bits;
+    bool_t                same;
+    int32_t               status;
+
+    status = val->crypto_function(VAL_CRYPTO_GET_KEY_ATTRIBUTES, key_id, &stored);
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &stored);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ID, attributes, key_id);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME, attributes,
+                             PSA_KEY_LIFETIME_PERSISTENT);
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, data, data_length,
+                                      &key_id);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME, attributes,
+                             PSA_KEY_LIFETIME_VOLATILE);
+        if (status == PSA_SUCCESS)
+        {
+            /* Keep the key out of the clean up of VAL_CRYPTO_FREE at test exit */
+            val->crypto_function(VAL_CRYPTO_UNTRACK_KEY, key_id);
+        }
+        return status;
+    }
+
+    val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, attributes, &type);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, attributes, &bits);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, attributes, &usage);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, attributes, &alg);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, &stored, &stored_type);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, &stored, &stored_bits);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, &stored, &stored_usage);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, &stored, &stored_alg);
+    val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &stored);
+
+    if ((stored_type != type) || (stored_alg != alg) ||
+        ((bits != 0) && (stored_bits != bits)) || ((stored_usage & usage) != usage))
+    {
+        /* Hash collision with a different fixture */
+        return PSA_ERROR_ALREADY_EXISTS;
+    }
+
+    status = crypto_fixture_same_material(attributes, data, data_length, key_id, &same);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+    if (same != TRUE)
+    {
+        /* Hash collision with a fixture of the same policy but other key material */
+        return PSA_ERROR_ALREADY_EXISTS;
+    }
+    return PSA_SUCCESS;
+}
+#endif
+
+/**
+    @brief    - Import a key for a test that only needs a valid key with the given
+                attributes and material. Until the key is destroyed, the same request
+                made again in this test, or with CRYPTO_KEY_FIXTURES in any later test or
+                run, returns the same key instead of importing it again. Asymmetric keys
+                are kept as persistent keys under CRYPTO_FIXTURE_KEY_ID_BASE when
+                CRYPTO_KEY_FIXTURES is defined, all other keys are volatile and released
+                when the test exits. The key must be destroyed with
+                crypto_fixture_destroy_key.
+    @param    - attributes : Key type, size and policy, volatile lifetime
+                data       : Key material
+                data_length: Key material length
+                key        : Returns the key ID
+    @return   - PSA status
+**/
+int32_t crypto_fixture_import_key(psa_key_attributes_t *attributes, const uint8_t *data,
+                                  size_t data_length, psa_key_id_t *key)
+{
+    psa_key_type_t        type;
+    psa_key_usage_t       usage;
+    psa_algorithm_t       alg;
+    size_t                bits;
+    uint32_t              hash = 0x811C9DC5;
+    uint32_t              i;
+    int32_t               status;
+
+    val->crypto_function(VAL_CRYPTO_GET_KEY_TYPE, attributes, &type);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_BITS, attributes, &bits);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_USAGE_FLAGS, attributes, &usage);
+    val->crypto_function(VAL_CRYPTO_GET_KEY_ALGORITHM, attributes, &alg);
+
+    hash = crypto_fixture_hash(hash, &type, sizeof(type));
+    hash = crypto_fixture_hash(hash, &bits, sizeof(bits));
+    hash = crypto_fixture_hash(hash, &usage, sizeof(usage));
+    hash = crypto_fixture_hash(hash, &alg, sizeof(alg));
+    hash = crypto_fixture_hash(hash, data, data_length);
+
+    for (i = 0; i < g_crypto_fixture_count; i++)
+    {
+        if (g_crypto_fixture[i].hash == hash)
+        {
+            *key = g_crypto_fixture[i].key;
+            return PSA_SUCCESS;
+        }
+    }
+
+    if (g_crypto_fixture_count == CRYPTO_FIXTURE_SLOTS)
+    {
+        /* Cache full, hand out an uncached key which crypto_fixture_destroy_key destroys */
+        return val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, data, data_length, key);
+    }
+
+#ifdef CRYPTO_KEY_FIXTURES
+    if (PSA_KEY_TYPE_IS_ASYMMETRIC(type))
+    {
+        *key = CRYPTO_FIXTURE_KEY_ID_BASE | (hash & CRYPTO_FIXTURE_KEY_ID_MASK);
+        status = crypto_fixture_persistent_key(attributes, data, data_length, *key);
+        if (status == PSA_SUCCESS)
+        {
+            g_crypto_fixture[g_crypto_fixture_count].hash = hash;
+            g_crypto_fixture[g_crypto_fixture_count].key = *key;
+            g_crypto_fixture[g_crypto_fixture_count].persistent = TRUE;
+            g_crypto_fixture_count++;
+            return status;
+        }
+        /* Out of key storage or a hash collision, fall back to a volatile key */
+    }
+#endif
+
+    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, data, data_length, key);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    g_crypto_fixture[g_crypto_fixture_count].hash = hash;
+    g_crypto_fixture[g_crypto_fixture_count].key = *key;
+    g_crypto_fixture[g_crypto_fixture_count].persistent = FALSE;
+    g_crypto_fixture_count++;
+    return status;
+}
+
+/**
+    @brief    - Destroy a key obtained from crypto_fixture_import_key. Tests check
+                psa_destroy_key with it, so the key is always destroyed, also when it is
+                a cached fixture. The fixture is dropped from the cache and the next
+                request imports it again.
+    @param    - key : Key ID
+    @return   - PSA status
+**/
+int32_t crypto_fixture_destroy_key(psa_key_id_t key)
+{
+    uint32_t i;
+
+    for (i = 0; i < g_crypto_fixture_count; i++)
+    {
+        if (g_crypto_fixture[i].key == key)
+        {
+            g_crypto_fixture[i] = g_crypto_fixture[--g_crypto_fixture_count];
+            break;
+        }
+    }
+    return val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+}
+
 /* crypto common testcase exit action */
 void crypto_common_exit_action(void)
 {
+	uint32_t i, count = 0;
+
 	g_test_count = 1;
+
+	/* Volatile fixture keys do not outlive the crypto library reset at test exit */
+	for (i = 0; i < g_crypto_fixture_count; i++)
+	{
+		if (g_crypto_fixture[i].persistent == TRUE)
+		{
+			g_crypto_fixture[count++] = g_crypto_fixture[i];
+		}
+	}
+	g_crypto_fixture_count = count;
 }
@@ -18,6 +18,7 @@
 #ifndef _TEST_CRYPTO_COMMON_H_
 #define _TEST_CRYPTO_COMMON_H_
 
+#include "val_interfaces.h"
 #include "val_crypto.h"
 
 #define INPUT_BYTES_DATA_LEN           16
@@ -40,6 +41,11 @@
 
 #define PSA_ERROR_PROGRAMMER_ERROR      ((psa_status_t)-129)
 
+/* Key fixture cache, see crypto_fixture_import_key */
+#define CRYPTO_FIXTURE_SLOTS           8
+#define CRYPTO_FIXTURE_KEY_ID_BASE     0x3FF00000
+#define CRYPTO_FIXTURE_KEY_ID_MASK     0x000FFFFF
+
 /* min and max finding macro */
 #define MIN(a, b) (((a) < (b))?(a):(b))
 #define MAX(a, b) (((a) > (b))?(a):(b))
@@ -121,5 +127,8 @@ extern const uint8_t cmac_aes_128[];
 extern uint8_t expected_output[BUFFER_SIZE];
 
 extern void crypto_common_exit_action(void);
+extern int32_t crypto_fixture_import_key(psa_key_attributes_t *attributes, const uint8_t *data,
+                                         size_t data_length, psa_key_id_t *key);
+extern int32_t crypto_fixture_destroy_key(psa_key_id_t key);
 
 #endif /* _TEST_CRYPTO_COMMON_H_ */
@@ -30,6 +30,7 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
 {
     int32_t                 num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t                 i, status;
+    uint32_t                latency;
     size_t                  expected_hash_length;
 
     if (num_checks == 0)
@@ -52,6 +53,7 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
 
         /* Calculate the hash (digest) of a message */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_HASH_COMPUTE,
                                       check1[i].alg,
                                       check1[i].input,
@@ -59,7 +61,9 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
                                       check1[i].hash,
                                       check1[i].hash_size,
                                       &expected_hash_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_HASH, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
@@ -29,6 +29,7 @@ const client_test_t test_c016_crypto_list[] = {
 int32_t psa_generate_key_test(caller_security_t caller __UNUSED)
 {
     int32_t               i, status;
+    uint32_t              latency;
     size_t                expected_data_length;
     psa_key_type_t        get_type;
     psa_key_usage_t       get_usage_flags;
@@ -66,8 +67,11 @@ int32_t psa_generate_key_test(caller_security_t caller __UNUSED)
         val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
 
         /* Generate the key */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_GENERATE_KEY, &attributes, &key);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_KEY_GENERATION, TEST_CHECKPOINT_NUM(3));
 
         if (check1[i].expected_status != PSA_SUCCESS)
             continue;
@@ -34,6 +34,7 @@ int32_t psa_generate_random_test(caller_security_t caller __UNUSED)
     uint32_t    j, run;
     uint8_t     trail[] = "don't overwrite me";
     int32_t     status;
+    uint32_t    latency;
 
     if (num_checks == 0)
     {
@@ -66,9 +67,12 @@ int32_t psa_generate_random_test(caller_security_t caller __UNUSED)
             memset(check1[i].output, 0, check1[i].output_size);
 
             /* Generate random bytes */
+            TEST_LATENCY_START(latency);
             status = val->crypto_function(VAL_CRYPTO_GENERATE_RANDOM, check1[i].output,
                                           check1[i].output_size);
+            TEST_LATENCY_END(latency);
             TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
+            TEST_ASSERT_LATENCY(latency, VAL_LATENCY_RANDOM, TEST_CHECKPOINT_NUM(3));
 
             /* Check that no more than bytes have been overwritten */
             status = memcmp(check1[i].output + check1[i].output_size, trail, sizeof(trail));
@@ -29,6 +29,7 @@ const client_test_t test_c020_crypto_list[] = {
 int32_t psa_key_derivation_output_bytes_test(caller_security_t caller __UNUSED)
 {
     int32_t                         status;
+    uint32_t                        latency;
     int32_t                         i, inIdx;
     int32_t                         num_checks = sizeof(check1)/sizeof(check1[0]);
     psa_key_attributes_t            attributes = PSA_KEY_ATTRIBUTES_INIT;
@@ -98,9 +99,12 @@ int32_t psa_key_derivation_output_bytes_test(caller_security_t caller __UNUSED)
         }
 
         /* Read some data from a key derivation operation */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES, &operation,
                                       check1[i].output, check1[i].output_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(8));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_KEY_DERIVATION, TEST_CHECKPOINT_NUM(8));
 
         status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
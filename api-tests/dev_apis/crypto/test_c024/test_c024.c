@@ -29,6 +29,7 @@ const client_test_t test_c024_crypto_list[] = {
 int32_t psa_aead_encrypt_test(caller_security_t caller __UNUSED)
 {
     int32_t               status, i;
+    uint32_t              latency;
     size_t                get_ciphertext_length;
     int                   num_checks = sizeof(check1)/sizeof(check1[0]);
     psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
@@ -67,6 +68,7 @@ int32_t psa_aead_encrypt_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Process an authenticated encryption operation */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_AEAD_ENCRYPT,
                                       key,
                                       check1[i].alg,
@@ -79,7 +81,9 @@ int32_t psa_aead_encrypt_test(caller_security_t caller __UNUSED)
                                       check1[i].ciphertext,
                                       check1[i].ciphertext_size,
                                       &get_ciphertext_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_AEAD, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
@@ -35,6 +35,7 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
 {
     int32_t                 num_checks = sizeof(check1)/sizeof(check1[valid_test_input_index]);
     int32_t                 i, status;
+    uint32_t                latency;
     size_t                  get_output_length;
     psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t            key;
@@ -64,11 +65,12 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
         val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = crypto_fixture_import_key(&attributes, check1[i].data,
+                                           check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Encrypt a short message with a public key */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_ASYMMETRIC_ENCRYPT,
                                       key,
                                       check1[i].alg,
@@ -79,12 +81,14 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
                                       check1[i].output,
                                       check1[i].output_size,
                                       &get_output_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_ASYMMETRIC_ENCRYPTION, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = crypto_fixture_destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             /* Reset the key attributes and check if psa_import_key fails */
@@ -123,7 +127,7 @@ int32_t psa_asymmetric_encrypt_test(caller_security_t caller __UNUSED)
         }
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = crypto_fixture_destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
         /* Reset the key attributes and check if psa_import_key fails */
@@ -35,6 +35,7 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
 {
     int32_t                 num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t                 i, status;
+    uint32_t                latency;
     size_t                  get_signature_length;
     psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t            key;
@@ -64,11 +65,12 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
         val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = crypto_fixture_import_key(&attributes, check1[i].data,
+                                          check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Sign a hash or short message with a private key */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_SIGN_HASH,
                                       key,
                                       check1[i].alg,
@@ -77,12 +79,14 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
                                       check1[i].signature,
                                       check1[i].signature_size,
                                       &get_signature_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_SIGN, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            status = crypto_fixture_destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             continue;
@@ -94,7 +98,7 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
 
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = crypto_fixture_destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
 
        /* verify the expected signature for the hash */
@@ -103,8 +107,8 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_VERIFY_HASH);
        /* Import the key data into the key slot */
-       status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+       status = crypto_fixture_import_key(&attributes, check1[i].data,
+                                          check1[i].data_length, &key);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
 	  /* Verify the signature a hash or short message using a public key */
@@ -117,7 +121,7 @@ int32_t psa_sign_hash_test(caller_security_t caller __UNUSED)
                                  check1[i].expected_signature_length);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
        /* Destroy the key */
-       status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+       status = crypto_fixture_destroy_key(key);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
        if (valid_test_input_index < 0)
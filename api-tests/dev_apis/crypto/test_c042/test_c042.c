@@ -35,6 +35,7 @@ int32_t psa_verify_hash_test(caller_security_t caller __UNUSED)
 {
     int32_t                 num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t                 i, status;
+    uint32_t                latency;
     psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t            key;
 
@@ -63,11 +64,12 @@ int32_t psa_verify_hash_test(caller_security_t caller __UNUSED)
         val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
-                                      check1[i].data_length, &key);
+        status = crypto_fixture_import_key(&attributes, check1[i].data,
+                                           check1[i].data_length, &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Verify the signature a hash or short message using a public key */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_VERIFY_HASH,
                                       key,
                                       check1[i].alg,
@@ -75,10 +77,12 @@ int32_t psa_verify_hash_test(caller_security_t caller __UNUSED)
                                       check1[i].hash_length,
                                       check1[i].signature,
                                       check1[i].signature_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_VERIFY, TEST_CHECKPOINT_NUM(4));
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        status = crypto_fixture_destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
         if (valid_test_input_index < 0)
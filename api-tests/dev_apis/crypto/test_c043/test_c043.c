@@ -35,6 +35,7 @@ int32_t psa_raw_key_agreement_test(caller_security_t caller __UNUSED)
 {
     int                     num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t                 i, status;
+    uint32_t                latency;
     size_t                  output_length;
     psa_key_attributes_t    attributes = PSA_KEY_ATTRIBUTES_INIT;
     psa_key_id_t            key;
@@ -69,10 +70,13 @@ int32_t psa_raw_key_agreement_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Set up a key agreement operation */
+        TEST_LATENCY_START(latency);
         status = val->crypto_function(VAL_CRYPTO_RAW_KEY_AGREEMENT, check1[i].key_alg,
                     key, check1[i].peer_key, check1[i].peer_key_length,
                     output, check1[i].output_size, &output_length);
+        TEST_LATENCY_END(latency);
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_LATENCY(latency, VAL_LATENCY_KEY_AGREEMENT, TEST_CHECKPOINT_NUM(4));
 
         if (check1[i].expected_status != PSA_SUCCESS)
         {
@@ -70,11 +70,10 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
                              check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = crypto_fixture_import_key(&attributes,
+                                           check1[i].data,
+                                           check1[i].data_length,
+                                           &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Sign a message with a private key */
@@ -91,8 +90,7 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
         if (check1[i].expected_status != PSA_SUCCESS)
         {
             /* Destroy the key */
-            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                          key);
+            status = crypto_fixture_destroy_key(key);
             TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
             continue;
@@ -107,8 +105,7 @@ int32_t psa_sign_message_test(caller_security_t caller __UNUSED)
                            TEST_CHECKPOINT_NUM(7));
 
         /* Destroy the key */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = crypto_fixture_destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
 
         if (valid_test_input_index < 0)
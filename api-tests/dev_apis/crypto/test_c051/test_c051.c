@@ -68,11 +68,10 @@ int32_t psa_verify_message_test(caller_security_t caller __UNUSED)
                              check1[i].usage_flags);
 
         /* Import the key data into the key slot */
-        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY,
-                                      &attributes,
-                                      check1[i].data,
-                                      check1[i].data_length,
-                                      &key);
+        status = crypto_fixture_import_key(&attributes,
+                                           check1[i].data,
+                                           check1[i].data_length,
+                                           &key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
 
         /* Verify the signature a hash or short message using a public key */
@@ -86,8 +85,7 @@ int32_t psa_verify_message_test(caller_security_t caller __UNUSED)
         TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(4));
 
         /* Destroy a key and restore the slot to its default state */
-        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY,
-                                      key);
+        status = crypto_fixture_destroy_key(key);
         TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
 
 
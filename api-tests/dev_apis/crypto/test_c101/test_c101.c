@@ -0,0 +1,205 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c101.h"
+
+/* Each check runs the same Welch's t-test harness over the positive vectors of one
+ * compliance test: test_c007 (psa_hash_compare), test_c047 (psa_mac_verify),
+ * test_c025 (psa_aead_decrypt) and test_c042 (psa_verify_hash).
+ */
+const client_test_t test_c101_crypto_list[] = {
+    NULL,
+    psa_hash_compare_ct_test,
+    psa_mac_verify_ct_test,
+    psa_aead_decrypt_ct_test,
+    psa_verify_hash_ct_test,
+    NULL,
+};
+
+/* Running mean and variance of the timings of one input class (Welford) */
+typedef struct {
+    uint32_t  n;
+    double    mean;
+    double    m2;
+} ct_stats_t;
+
+static uint32_t g_ct_seed = 0x2545F491;
+
+/**
+    @brief    - Returns the input class of the next timed call. A linear congruential
+                generator is enough to keep the classes from following any pattern of
+                the system under test.
+    @param    - void
+    @return   - BENCH_CT_CLASS_FIRST_BYTE or BENCH_CT_CLASS_LAST_BYTE
+**/
+static uint32_t ct_next_class(void)
+{
+    g_ct_seed = (g_ct_seed * 1103515245) + 12345;
+    return (g_ct_seed >> 16) & 1;
+}
+
+/**
+    @brief    - Adds a timing to the statistics of its class
+    @param    - stats   : statistics of the class
+                x       : timing in nano seconds
+    @return   - void
+**/
+static void ct_stats_push(ct_stats_t *stats, double x)
+{
+    double delta;
+
+    stats->n++;
+    delta = x - stats->mean;
+    stats->mean += delta / stats->n;
+    stats->m2 += delta * (x - stats->mean);
+}
+
+/**
+    @brief    - Square root by Newton iteration, the test suite is not linked with libm
+    @param    - x : non-negative value
+    @return   - square root of x
+**/
+static double ct_sqrt(double x)
+{
+    double r = (x > 1) ? x : 1;
+    int    i;
+
+    for (i = 0; i < 64; i++)
+    {
+        r = (r + x / r) / 2;
+    }
+    return r;
+}
+
+/**
+    @brief    - Welch's t statistic between the timings of the two input classes
+    @param    - stats : statistics of the first byte and last byte classes
+    @return   - |t|, zero while either class has fewer than two timings
+**/
+static double ct_welch_t(const ct_stats_t *stats)
+{
+    double var0, var1, den, diff;
+
+    if (stats[0].n < 2 || stats[1].n < 2)
+    {
+        return 0;
+    }
+
+    diff = stats[0].mean - stats[1].mean;
+    diff = (diff < 0) ? -diff : diff;
+    var0 = stats[0].m2 / (stats[0].n - 1);
+    var1 = stats[1].m2 / (stats[1].n - 1);
+    den  = var0 / stats[0].n + var1 / stats[1].n;
+
+    /* Noise free timings: any difference of the means is a leak */
+    if (den <= 0)
+    {
+        return (diff > 0) ? (BENCH_CT_T_THRESHOLD * 100) : 0;
+    }
+    return diff / ct_sqrt(den);
+}
+
+/**
+    @brief    - Times one call of the operation under test
+    @param    - op           : operation under test
+                ctx          : operation context
+                input_class  : input class to call the operation with
+    @return   - time taken in nano seconds
+**/
+static uint32_t ct_time_call(ct_operation_t op, const void *ctx, uint32_t input_class)
+{
+    uint32_t start, end;
+
+    start = val->timestamp_get();
+    op(ctx, input_class);
+    end = val->timestamp_get();
+
+    return val->timestamp_elapsed(start, end);
+}
+
+/**
+    @brief    - Times the operation over randomly interleaved inputs altered in their
+                first and in their last byte and runs Welch's t-test on the two timing distributions, once on
+                all timings and once with the slowest ones cropped to remove interrupt
+                and scheduling noise.
+    @param    - op    : operation under test
+                ctx   : operation context
+    @return   - TRUE if the distributions differ by more than BENCH_CT_T_THRESHOLD
+**/
+bool_t ct_measure(ct_operation_t op, const void *ctx)
+{
+    uint32_t    warmup[BENCH_CT_WARMUP];
+    ct_stats_t  raw[2], cropped[2];
+    uint32_t    i, j, x, crop, input_class;
+    double      t_raw, t_cropped, t_max;
+
+    memset(raw, 0, sizeof(raw));
+    memset(cropped, 0, sizeof(cropped));
+
+    /* Warm up and sort the warm-up timings to find the cropping threshold */
+    for (i = 0; i < BENCH_CT_WARMUP; i++)
+    {
+        x = ct_time_call(op, ctx, i & 1);
+        for (j = i; (j > 0) && (warmup[j - 1] > x); j--)
+        {
+            warmup[j] = warmup[j - 1];
+        }
+        warmup[j] = x;
+    }
+    crop = warmup[(BENCH_CT_WARMUP * BENCH_CT_CROP_PERCENTILE) / 100];
+
+    for (i = 0; i < BENCH_CT_MEASUREMENTS; i++)
+    {
+        if ((i % BENCH_CT_WD_INTERVAL) == 0)
+        {
+            val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        }
+
+        input_class = ct_next_class();
+        x = ct_time_call(op, ctx, input_class);
+
+        ct_stats_push(&raw[input_class], x);
+        if (x <= crop)
+        {
+            ct_stats_push(&cropped[input_class], x);
+        }
+    }
+
+    t_raw     = ct_welch_t(raw);
+    t_cropped = ct_welch_t(cropped);
+    t_max     = (t_raw > t_cropped) ? t_raw : t_cropped;
+
+    val->print(PRINT_TEST, "\tFirst byte altered mean   : %d ns\n", (int32_t)raw[0].mean);
+    val->print(PRINT_TEST, "\tLast byte altered mean    : %d ns\n", (int32_t)raw[1].mean);
+    val->print(PRINT_TEST, "\tWelch |t| x100            : %d", (int32_t)(t_raw * 100));
+    val->print(PRINT_TEST, " (cropped at %d ns", (int32_t)crop);
+    val->print(PRINT_TEST, " : %d)\n", (int32_t)(t_cropped * 100));
+
+    if (t_max > BENCH_CT_T_THRESHOLD)
+    {
+        val->print(PRINT_ERROR, "\tTiming leak detected\n", 0);
+        return TRUE;
+    }
+
+    if (t_max > BENCH_CT_T_WARNING)
+    {
+        val->print(PRINT_WARN, "\tPossible timing leak, rerun with more measurements\n", 0);
+    }
+    return FALSE;
+}
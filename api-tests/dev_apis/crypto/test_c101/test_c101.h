@@ -0,0 +1,66 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_C101_CLIENT_TESTS_H_
+#define _TEST_C101_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c101)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* Number of timed calls per algorithm, split randomly between the two input classes */
+#ifndef BENCH_CT_MEASUREMENTS
+#define BENCH_CT_MEASUREMENTS      10000
+#endif
+
+/* Untimed calls used to warm caches and to pick the cropping threshold */
+#define BENCH_CT_WARMUP            128
+
+/* Samples above this percentile of the warm-up are dropped from the cropped t-test */
+#define BENCH_CT_CROP_PERCENTILE   90
+
+/* |t| above which the two timing distributions are reported as different (dudect) */
+#define BENCH_CT_T_THRESHOLD       10
+
+/* |t| above which a possible leak is reported, needing more measurements to confirm */
+#define BENCH_CT_T_WARNING         5
+
+/* Number of timed calls between two watchdog reprograms */
+#define BENCH_CT_WD_INTERVAL       64
+
+/* Largest tag, hash or ciphertext the altered inputs can be built from */
+#define BENCH_CT_BUFFER_SIZE       128
+
+/* Input classes of the t-test, both rejected: altered in their first or in their last byte */
+#define BENCH_CT_CLASS_FIRST_BYTE  0
+#define BENCH_CT_CLASS_LAST_BYTE   1
+
+/* Operation under test, called with the input class it must use */
+typedef int32_t (*ct_operation_t)(const void *ctx, uint32_t input_class);
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c101_crypto_list[];
+
+bool_t ct_measure(ct_operation_t op, const void *ctx);
+int32_t psa_hash_compare_ct_test(caller_security_t caller);
+int32_t psa_mac_verify_ct_test(caller_security_t caller);
+int32_t psa_aead_decrypt_ct_test(caller_security_t caller);
+int32_t psa_verify_hash_ct_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C101_CLIENT_TESTS_H_ */
@@ -0,0 +1,141 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c101.h"
+#include "../test_c025/test_data.h"
+
+extern  uint32_t g_test_count;
+
+typedef struct {
+    psa_key_id_t      key;
+    psa_algorithm_t   alg;
+    const uint8_t    *nonce;
+    size_t            nonce_length;
+    const uint8_t    *additional_data;
+    size_t            additional_data_length;
+    const uint8_t    *ciphertext[2];
+    size_t            ciphertext_length;
+    uint8_t          *plaintext;
+    size_t            plaintext_size;
+    size_t           *plaintext_length;
+} ct_aead_ctx_t;
+
+static int32_t ct_aead_decrypt(const void *ctx, uint32_t input_class)
+{
+    const ct_aead_ctx_t *c = (const ct_aead_ctx_t *)ctx;
+
+    return val->crypto_function(VAL_CRYPTO_AEAD_DECRYPT, c->key, c->alg,
+                                c->nonce, c->nonce_length,
+                                c->additional_data, c->additional_data_length,
+                                c->ciphertext[input_class], c->ciphertext_length,
+                                c->plaintext, c->plaintext_size, c->plaintext_length);
+}
+
+int32_t psa_aead_decrypt_ct_test(caller_security_t caller __UNUSED)
+{
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                i, status, leaks = 0;
+    uint8_t                altered[2][BENCH_CT_BUFFER_SIZE];
+    uint8_t                plaintext[BENCH_CT_BUFFER_SIZE];
+    size_t                 plaintext_length;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+    ct_aead_ctx_t          ctx;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only the vectors with an authentic tag, following the ciphertext, can be timed */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            (check1[i].ciphertext_length <= check1[i].expected_plaintext_length) ||
+            (check1[i].ciphertext_length > sizeof(altered[0])) ||
+            (check1[i].expected_plaintext_length > sizeof(plaintext)))
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+                                      check1[i].data_length, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        ctx.alg                    = check1[i].alg;
+        ctx.nonce                  = check1[i].nonce;
+        ctx.nonce_length           = check1[i].nonce_length;
+        ctx.additional_data        = check1[i].additional_data;
+        ctx.additional_data_length = check1[i].additional_data_length;
+        ctx.ciphertext[BENCH_CT_CLASS_FIRST_BYTE] = check1[i].ciphertext;
+        ctx.ciphertext_length      = check1[i].ciphertext_length;
+        ctx.plaintext              = plaintext;
+        ctx.plaintext_size         = sizeof(plaintext);
+        ctx.plaintext_length       = &plaintext_length;
+
+        /* The reference ciphertext must decrypt before the altered ones are timed */
+        status = ct_aead_decrypt(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        /* Both classes carry a rejected tag, altered in its first or in its last byte, so an
+         * early abort on the error path times the same for both and only a tag comparison
+         * stopping at the first differing byte shows
+         */
+        memcpy(altered[BENCH_CT_CLASS_FIRST_BYTE], check1[i].ciphertext,
+               check1[i].ciphertext_length);
+        memcpy(altered[BENCH_CT_CLASS_LAST_BYTE], check1[i].ciphertext,
+               check1[i].ciphertext_length);
+        altered[BENCH_CT_CLASS_FIRST_BYTE][check1[i].expected_plaintext_length] ^= 0x01;
+        altered[BENCH_CT_CLASS_LAST_BYTE][check1[i].ciphertext_length - 1] ^= 0x01;
+        ctx.ciphertext[BENCH_CT_CLASS_FIRST_BYTE] = altered[BENCH_CT_CLASS_FIRST_BYTE];
+        ctx.ciphertext[BENCH_CT_CLASS_LAST_BYTE]  = altered[BENCH_CT_CLASS_LAST_BYTE];
+
+        status = ct_aead_decrypt(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(4));
+        status = ct_aead_decrypt(&ctx, BENCH_CT_CLASS_LAST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(4));
+
+        if (ct_measure(ct_aead_decrypt, &ctx) == TRUE)
+        {
+            leaks++;
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    TEST_ASSERT_EQUAL(leaks, 0, TEST_CHECKPOINT_NUM(6));
+
+    return VAL_STATUS_SUCCESS;
+}
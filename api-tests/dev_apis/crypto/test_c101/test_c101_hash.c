@@ -0,0 +1,104 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c101.h"
+#include "../test_c007/test_data.h"
+
+extern  uint32_t g_test_count;
+
+typedef struct {
+    psa_algorithm_t   alg;
+    const uint8_t    *input;
+    size_t            input_length;
+    const uint8_t    *hash[2];
+    size_t            hash_length;
+} ct_hash_ctx_t;
+
+static int32_t ct_hash_compare(const void *ctx, uint32_t input_class)
+{
+    const ct_hash_ctx_t *c = (const ct_hash_ctx_t *)ctx;
+
+    return val->crypto_function(VAL_CRYPTO_HASH_COMPARE, c->alg, c->input, c->input_length,
+                                c->hash[input_class], c->hash_length);
+}
+
+int32_t psa_hash_compare_ct_test(caller_security_t caller __UNUSED)
+{
+    int32_t         num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t         i, status, leaks = 0;
+    uint8_t         altered[2][BENCH_CT_BUFFER_SIZE];
+    ct_hash_ctx_t   ctx;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only the vectors with a matching reference hash can be timed */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            (check1[i].hash_length == 0) || (check1[i].hash_length > sizeof(altered[0])))
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        ctx.alg          = check1[i].alg;
+        ctx.input        = check1[i].input;
+        ctx.input_length = check1[i].input_length;
+        ctx.hash[BENCH_CT_CLASS_FIRST_BYTE] = check1[i].hash;
+        ctx.hash_length  = check1[i].hash_length;
+
+        /* The reference hash must compare equal before the altered ones are timed */
+        status = ct_hash_compare(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* Both classes are rejected hashes, so an early abort on the error path times the
+         * same for both and only a comparison stopping at the first differing byte shows
+         */
+        memcpy(altered[BENCH_CT_CLASS_FIRST_BYTE], check1[i].hash, check1[i].hash_length);
+        memcpy(altered[BENCH_CT_CLASS_LAST_BYTE], check1[i].hash, check1[i].hash_length);
+        altered[BENCH_CT_CLASS_FIRST_BYTE][0] ^= 0x01;
+        altered[BENCH_CT_CLASS_LAST_BYTE][check1[i].hash_length - 1] ^= 0x01;
+        ctx.hash[BENCH_CT_CLASS_FIRST_BYTE] = altered[BENCH_CT_CLASS_FIRST_BYTE];
+        ctx.hash[BENCH_CT_CLASS_LAST_BYTE]  = altered[BENCH_CT_CLASS_LAST_BYTE];
+
+        status = ct_hash_compare(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(3));
+        status = ct_hash_compare(&ctx, BENCH_CT_CLASS_LAST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(3));
+
+        if (ct_measure(ct_hash_compare, &ctx) == TRUE)
+        {
+            leaks++;
+        }
+    }
+
+    TEST_ASSERT_EQUAL(leaks, 0, TEST_CHECKPOINT_NUM(4));
+
+    return VAL_STATUS_SUCCESS;
+}
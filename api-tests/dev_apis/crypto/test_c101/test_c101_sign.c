@@ -0,0 +1,121 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c101.h"
+#include "../test_c042/test_data.h"
+
+extern  uint32_t g_test_count;
+
+typedef struct {
+    psa_key_id_t      key;
+    psa_algorithm_t   alg;
+    const uint8_t    *hash[2];
+    size_t            hash_length;
+    const uint8_t    *signature;
+    size_t            signature_length;
+} ct_sign_ctx_t;
+
+static int32_t ct_verify_hash(const void *ctx, uint32_t input_class)
+{
+    const ct_sign_ctx_t *c = (const ct_sign_ctx_t *)ctx;
+
+    return val->crypto_function(VAL_CRYPTO_VERIFY_HASH, c->key, c->alg, c->hash[input_class],
+                                c->hash_length, c->signature, c->signature_length);
+}
+
+int32_t psa_verify_hash_ct_test(caller_security_t caller __UNUSED)
+{
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                i, status, leaks = 0;
+    uint8_t                altered[2][BENCH_CT_BUFFER_SIZE];
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+    ct_sign_ctx_t          ctx;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        /* Only the vectors with a valid signature can be timed */
+        if ((check1[i].expected_status != PSA_SUCCESS) ||
+            (check1[i].hash_length == 0) || (check1[i].hash_length > sizeof(altered[0])))
+        {
+            continue;
+        }
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key */
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,        &attributes, check1[i].type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM,   &attributes, check1[i].alg);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, check1[i].usage_flags);
+
+        /* Import the key data into the key slot */
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+                                      check1[i].data_length, &ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        ctx.alg              = check1[i].alg;
+        ctx.hash[BENCH_CT_CLASS_FIRST_BYTE] = check1[i].hash;
+        ctx.hash_length      = check1[i].hash_length;
+        ctx.signature        = check1[i].signature;
+        ctx.signature_length = check1[i].signature_length;
+
+        /* The reference signature must verify before the altered hashes are timed */
+        status = ct_verify_hash(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        /* The signature is kept and the signed hash altered in its first or in its last
+         * byte, so both classes are rejected after the same public key operation
+         */
+        memcpy(altered[BENCH_CT_CLASS_FIRST_BYTE], check1[i].hash, check1[i].hash_length);
+        memcpy(altered[BENCH_CT_CLASS_LAST_BYTE], check1[i].hash, check1[i].hash_length);
+        altered[BENCH_CT_CLASS_FIRST_BYTE][0] ^= 0x01;
+        altered[BENCH_CT_CLASS_LAST_BYTE][check1[i].hash_length - 1] ^= 0x01;
+        ctx.hash[BENCH_CT_CLASS_FIRST_BYTE] = altered[BENCH_CT_CLASS_FIRST_BYTE];
+        ctx.hash[BENCH_CT_CLASS_LAST_BYTE]  = altered[BENCH_CT_CLASS_LAST_BYTE];
+
+        status = ct_verify_hash(&ctx, BENCH_CT_CLASS_FIRST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(4));
+        status = ct_verify_hash(&ctx, BENCH_CT_CLASS_LAST_BYTE);
+        TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(4));
+
+        if (ct_measure(ct_verify_hash, &ctx) == TRUE)
+        {
+            leaks++;
+        }
+
+        /* Destroy the key */
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, ctx.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    TEST_ASSERT_EQUAL(leaks, 0, TEST_CHECKPOINT_NUM(6));
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,317 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c102.h"
+#include "test_crypto_common.h"
+
+const client_test_t test_c102_crypto_list[] = {
+    NULL,
+    psa_key_store_scaling_test,
+    NULL,
+};
+
+extern  uint32_t g_test_count;
+
+#if defined(ARCH_TEST_HMAC) && defined(ARCH_TEST_SHA256)
+/* Key counts at which the key store is measured, 1-2-5 steps up to BENCH_KS_MAX_KEYS */
+static const uint32_t g_ks_key_counts[] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000,
+};
+
+static const char g_ks_operation_name[BENCH_KS_OPERATIONS][24] = {
+    "\tpsa_import_key         ",
+    "\tpsa_get_key_attributes ",
+    "\tpsa_mac_compute        ",
+    "\tpsa_destroy_key        ",
+};
+
+/* Names of the PERF metrics, indexed by the key count */
+static const char g_ks_metric_name[BENCH_KS_OPERATIONS][24] = {
+    "psa_import_key",
+    "psa_get_key_attributes",
+    "psa_mac_compute",
+    "psa_destroy_key",
+};
+
+static psa_key_id_t g_ks_keys[BENCH_KS_MAX_KEYS];
+
+/**
+    @brief    - Times BENCH_KS_SAMPLES calls of each key store operation with key_count
+                keys in the store. The keys looked up are spread over the whole store.
+    @param    - attributes  : attributes of the keys in the store
+                key_count   : number of keys in the store
+                mean_ns     : mean time of each operation in nano seconds, zero for an
+                              import that did not fit in the store
+    @return   - PSA status of the first unexpected failure
+**/
+static int32_t ks_measure(const psa_key_attributes_t *attributes, uint32_t key_count,
+                          uint32_t *mean_ns)
+{
+    psa_key_attributes_t   read_attributes = PSA_KEY_ATTRIBUTES_INIT;
+    uint64_t               total_ns[BENCH_KS_OPERATIONS];
+    uint32_t               start, s, op;
+    int32_t                status;
+    psa_key_id_t           key, extra_key;
+    uint8_t                mac[PSA_HASH_MAX_SIZE];
+    size_t                 mac_length;
+    bool_t                 store_full = FALSE;
+
+    memset(total_ns, 0, sizeof(total_ns));
+
+    for (s = 0; s < BENCH_KS_SAMPLES; s++)
+    {
+        key = g_ks_keys[(s * key_count) / BENCH_KS_SAMPLES];
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_GET_KEY_ATTRIBUTES, key, &read_attributes);
+        total_ns[BENCH_KS_GET_ATTRIBUTES] += val->timestamp_elapsed(start,
+                                                                    val->timestamp_get());
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &read_attributes);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_MAC_COMPUTE, key,
+                                      PSA_ALG_HMAC(PSA_ALG_SHA_256),
+                                      input_bytes_data, INPUT_BYTES_DATA_LEN,
+                                      mac, sizeof(mac), &mac_length);
+        total_ns[BENCH_KS_MAC_COMPUTE] += val->timestamp_elapsed(start, val->timestamp_get());
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+
+        /* Import and destroy one more key, leaving key_count keys in the store */
+        if (store_full == TRUE)
+        {
+            continue;
+        }
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, key_data,
+                                      AES_32B_KEY_SIZE, &extra_key);
+        total_ns[BENCH_KS_IMPORT] += val->timestamp_elapsed(start, val->timestamp_get());
+        if (status == PSA_ERROR_INSUFFICIENT_MEMORY)
+        {
+            store_full = TRUE;
+            continue;
+        }
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, extra_key);
+        total_ns[BENCH_KS_DESTROY] += val->timestamp_elapsed(start, val->timestamp_get());
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    for (op = 0; op < BENCH_KS_OPERATIONS; op++)
+    {
+        mean_ns[op] = (uint32_t)(total_ns[op] / BENCH_KS_SAMPLES);
+    }
+    if (store_full == TRUE)
+    {
+        mean_ns[BENCH_KS_IMPORT]  = 0;
+        mean_ns[BENCH_KS_DESTROY] = 0;
+    }
+
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Grows the store through g_ks_key_counts, measuring and reporting the key
+                store latency at each count
+    @param    - attributes  : attributes of the keys in the store
+                key_count   : returns the number of keys imported into g_ks_keys, which
+                              must be destroyed whatever the result
+    @return   - val_status_t
+**/
+static int32_t ks_run(const psa_key_attributes_t *attributes, uint32_t *key_count)
+{
+    int32_t                status;
+    uint32_t               i, op, measured_count = 0, num_counts;
+    uint32_t               mean_ns[BENCH_KS_OPERATIONS], first_ns[BENCH_KS_OPERATIONS];
+    uint32_t               heap_start = 0, heap_end = 0;
+    bool_t                 heap_known, store_full = FALSE;
+
+    num_counts = sizeof(g_ks_key_counts)/sizeof(g_ks_key_counts[0]);
+    memset(first_ns, 0, sizeof(first_ns));
+
+    heap_known = (val->heap_used(&heap_start) == VAL_STATUS_SUCCESS) ? TRUE : FALSE;
+
+    for (i = 0; (i < num_counts) && (g_ks_key_counts[i] <= BENCH_KS_MAX_KEYS); i++)
+    {
+        /* Grow the store to the next measured key count */
+        while ((*key_count < g_ks_key_counts[i]) && (store_full == FALSE))
+        {
+            if ((*key_count % BENCH_KS_WD_INTERVAL) == 0)
+            {
+                val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            }
+
+            status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, key_data,
+                                          AES_32B_KEY_SIZE, &g_ks_keys[*key_count]);
+            if (status == PSA_ERROR_INSUFFICIENT_MEMORY)
+            {
+                store_full = TRUE;
+                break;
+            }
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+            (*key_count)++;
+        }
+
+        /* A store that filled up before the next count is only measured once more */
+        if (*key_count == measured_count)
+        {
+            break;
+        }
+        measured_count = *key_count;
+
+        val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        status = ks_measure(attributes, *key_count, mean_ns);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        if (i == 0)
+        {
+            memcpy(first_ns, mean_ns, sizeof(first_ns));
+        }
+
+        val->print(PRINT_TEST, "\tKeys in store          : %d\n", *key_count);
+        for (op = 0; op < BENCH_KS_OPERATIONS; op++)
+        {
+            if (mean_ns[op] == 0)
+            {
+                continue;
+            }
+            val->print(PRINT_TEST, g_ks_operation_name[op], 0);
+            val->print(PRINT_TEST, ": %d ns\n", mean_ns[op]);
+            val->perf_metric(g_ks_metric_name[op], *key_count, mean_ns[op], BENCH_KS_SAMPLES);
+        }
+
+        if (store_full == TRUE)
+        {
+            break;
+        }
+    }
+
+    TEST_ASSERT_NOT_EQUAL(*key_count, 0, TEST_CHECKPOINT_NUM(4));
+
+    val->print(PRINT_TEST, "\tMaximum keys reached   : %d", *key_count);
+    val->print(PRINT_TEST, (store_full == TRUE) ? " (PSA_ERROR_INSUFFICIENT_MEMORY)\n" :
+                                                  " (BENCH_KS_MAX_KEYS)\n", 0);
+
+    /* Latency with the largest store relative to a single key */
+    for (op = 0; op < BENCH_KS_OPERATIONS; op++)
+    {
+        if ((first_ns[op] == 0) || (mean_ns[op] == 0))
+        {
+            continue;
+        }
+        val->print(PRINT_TEST, g_ks_operation_name[op], 0);
+        val->print(PRINT_TEST, ": %d percent of the single key latency\n",
+                   (int32_t)(((uint64_t)mean_ns[op] * 100) / first_ns[op]));
+    }
+
+    if ((heap_known == TRUE) && (val->heap_used(&heap_end) == VAL_STATUS_SUCCESS) &&
+        (heap_end > heap_start))
+    {
+        val->print(PRINT_TEST, "\tHeap used per key      : %d bytes\n",
+                   (heap_end - heap_start) / *key_count);
+    }
+    else
+    {
+        val->print(PRINT_TEST, "\tHeap used per key      : not measurable on this target\n", 0);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Destroys the first key_count keys of g_ks_keys, carrying on past a failure
+    @param    - key_count   : number of keys in the store
+    @return   - PSA status of the first failed destroy
+**/
+static int32_t ks_empty(uint32_t key_count)
+{
+    int32_t                status, first_status = PSA_SUCCESS;
+    uint32_t               i;
+
+    for (i = 0; i < key_count; i++)
+    {
+        if ((i % BENCH_KS_WD_INTERVAL) == 0)
+        {
+            val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        }
+
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, g_ks_keys[i]);
+        if ((status != PSA_SUCCESS) && (first_status == PSA_SUCCESS))
+        {
+            first_status = status;
+        }
+    }
+
+    return first_status;
+}
+#endif
+
+int32_t psa_key_store_scaling_test(caller_security_t caller __UNUSED)
+{
+#if defined(ARCH_TEST_HMAC) && defined(ARCH_TEST_SHA256)
+    int32_t                status, destroy_status;
+    uint32_t               key_count = 0;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Test psa key store latency with up to %d HMAC keys\n",
+               BENCH_KS_MAX_KEYS);
+
+    /* Setup the attributes for the key */
+    val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, PSA_KEY_TYPE_HMAC);
+    val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_SIGN_HASH);
+    val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes,
+                         PSA_ALG_HMAC(PSA_ALG_SHA_256));
+
+    status = ks_run(&attributes, &key_count);
+
+    /* Empty the store, also after a failed check, as only a few of these volatile keys are
+       tracked by the PAL and none may leak into the later tests */
+    destroy_status = ks_empty(key_count);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    TEST_ASSERT_EQUAL(destroy_status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+    return VAL_STATUS_SUCCESS;
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
@@ -0,0 +1,52 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_C102_CLIENT_TESTS_H_
+#define _TEST_C102_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c102)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* Largest number of live volatile keys, unless the store runs out of memory first */
+#ifndef BENCH_KS_MAX_KEYS
+#define BENCH_KS_MAX_KEYS          10000
+#endif
+
+/* Timed calls of each API at every measured key count */
+#define BENCH_KS_SAMPLES           16
+
+/* Number of untimed imports or destroys between two watchdog reprograms */
+#define BENCH_KS_WD_INTERVAL       64
+
+/* Operations timed at every measured key count */
+typedef enum {
+    BENCH_KS_IMPORT = 0,
+    BENCH_KS_GET_ATTRIBUTES,
+    BENCH_KS_MAC_COMPUTE,
+    BENCH_KS_DESTROY,
+    BENCH_KS_OPERATIONS,
+} bench_ks_operation_t;
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c102_crypto_list[];
+
+int32_t psa_key_store_scaling_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C102_CLIENT_TESTS_H_ */
@@ -0,0 +1,307 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c103.h"
+#include "test_data.h"
+
+const client_test_t test_c103_crypto_list[] = {
+    NULL,
+    psa_persistent_key_lifecycle_test,
+    psa_persistent_key_store_scaling_test,
+    NULL,
+};
+
+extern  uint32_t g_test_count;
+
+#ifdef ARCH_TEST_AES_128
+/* Background key counts at which the probe key is measured, 1-2-5 steps */
+static const uint32_t g_pk_key_counts[] = {
+    0, 1, 2, 5, 10, 20, 50, 100, 200, 500, 1000,
+};
+
+static const char g_pk_operation_name[BENCH_PK_OPERATIONS][40] = {
+    "\tpsa_import_key (create)         ",
+    "\tpsa_export_key (warm)           ",
+    "\tpsa_purge_key                   ",
+    "\tpsa_export_key (reload from ITS)",
+    "\tpsa_destroy_key                 ",
+};
+
+/* Names of the PERF metrics of the lifecycle check and of the scaling check */
+static const char g_pk_metric_name[2][BENCH_PK_OPERATIONS][24] = {
+    {"create", "warm_use", "purge", "cold_use", "destroy"},
+    {"scaling_create", "scaling_warm_use", "scaling_purge", "scaling_cold_use",
+     "scaling_destroy"},
+};
+
+static uint8_t g_pk_export[BENCH_PK_EXPORT_SIZE];
+
+/**
+    @brief    - Removes a persistent key left in storage by an earlier, interrupted run
+    @param    - key_id  : persistent key identifier
+    @return   - void
+**/
+static void pk_clear(psa_key_id_t key_id)
+{
+    /* The key is normally absent, so the status is not checked */
+    (void)val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key_id);
+}
+
+/**
+    @brief    - Runs one persistent key lifecycle and adds the time of each step to
+                total_ns. The key is used by exporting it, once warm and once right
+                after it was purged, which forces a reload from storage.
+    @param    - attributes  : persistent key attributes, including the key identifier
+                data        : key material
+                data_length : key material length
+                total_ns    : time of each step in nano seconds, accumulated
+    @return   - PSA status of the first failure
+**/
+static int32_t pk_lifecycle(const psa_key_attributes_t *attributes, const uint8_t *data,
+                            size_t data_length, uint64_t *total_ns)
+{
+    uint32_t       start;
+    int32_t        status;
+    psa_key_id_t   key;
+    size_t         length;
+
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, attributes, data, data_length, &key);
+    total_ns[BENCH_PK_CREATE] += val->timestamp_elapsed(start, val->timestamp_get());
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    /* The first use only warms the caches and is not timed */
+    status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key, g_pk_export,
+                                  sizeof(g_pk_export), &length);
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key, g_pk_export,
+                                  sizeof(g_pk_export), &length);
+    total_ns[BENCH_PK_WARM_USE] += val->timestamp_elapsed(start, val->timestamp_get());
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_PURGE_KEY, key);
+    total_ns[BENCH_PK_PURGE] += val->timestamp_elapsed(start, val->timestamp_get());
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key, g_pk_export,
+                                  sizeof(g_pk_export), &length);
+    total_ns[BENCH_PK_COLD_USE] += val->timestamp_elapsed(start, val->timestamp_get());
+    if (status != PSA_SUCCESS)
+    {
+        return status;
+    }
+
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+    total_ns[BENCH_PK_DESTROY] += val->timestamp_elapsed(start, val->timestamp_get());
+
+    return status;
+}
+
+/**
+    @brief    - Runs BENCH_PK_SAMPLES lifecycles of one key and prints the mean time
+                of each step
+    @param    - attributes  : persistent key attributes, including the key identifier
+                data        : key material
+                data_length : key material length
+                scaling     : FALSE for the lifecycle check, TRUE for the scaling check
+                index       : row of the PERF metrics, the key type or the key count
+    @return   - PSA status of the first failure
+**/
+static int32_t pk_measure(const psa_key_attributes_t *attributes, const uint8_t *data,
+                          size_t data_length, bool_t scaling, uint32_t index)
+{
+    uint64_t   total_ns[BENCH_PK_OPERATIONS];
+    uint32_t   s, op;
+    int32_t    status;
+
+    memset(total_ns, 0, sizeof(total_ns));
+
+    for (s = 0; s < BENCH_PK_SAMPLES; s++)
+    {
+        val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        status = pk_lifecycle(attributes, data, data_length, total_ns);
+        if (status != PSA_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    for (op = 0; op < BENCH_PK_OPERATIONS; op++)
+    {
+        val->print(PRINT_TEST, g_pk_operation_name[op], 0);
+        val->print(PRINT_TEST, " : %d ns\n", (int32_t)(total_ns[op] / BENCH_PK_SAMPLES));
+        val->perf_metric(g_pk_metric_name[(scaling == TRUE) ? 1 : 0][op], index,
+                         (uint32_t)(total_ns[op] / BENCH_PK_SAMPLES), BENCH_PK_SAMPLES);
+    }
+
+    if (total_ns[BENCH_PK_WARM_USE] != 0)
+    {
+        val->print(PRINT_TEST, "\tFirst use after purge            : %d percent of warm use\n",
+                   (int32_t)((total_ns[BENCH_PK_COLD_USE] * 100) /
+                   total_ns[BENCH_PK_WARM_USE]));
+    }
+
+    return PSA_SUCCESS;
+}
+#endif
+
+int32_t psa_persistent_key_lifecycle_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_AES_128
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                i, status;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, "Test persistent key lifecycle - ", 0);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        /* Setup the attributes for the key */
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_EXPORT);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME, &attributes,
+                             PSA_KEY_LIFETIME_PERSISTENT);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ID, &attributes, BENCH_PK_KEY_ID_BASE);
+
+        pk_clear(BENCH_PK_KEY_ID_BASE);
+
+        status = pk_measure(&attributes, check1[i].data, check1[i].data_length, FALSE, i);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
+
+int32_t psa_persistent_key_store_scaling_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_AES_128
+    int32_t                status;
+    uint32_t               i, key_count = 0, num_counts;
+    bool_t                 store_full = FALSE;
+    psa_key_id_t           key;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    num_counts = sizeof(g_pk_key_counts)/sizeof(g_pk_key_counts[0]);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Test persistent key lifecycle with up to %d stored keys\n",
+               BENCH_PK_MAX_KEYS);
+
+    /* Setup the attributes for the probe and background keys */
+    val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, PSA_KEY_TYPE_AES);
+    val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_EXPORT);
+    val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME, &attributes, PSA_KEY_LIFETIME_PERSISTENT);
+
+    for (i = 0; (i < num_counts) && (g_pk_key_counts[i] <= BENCH_PK_MAX_KEYS); i++)
+    {
+        /* Store background keys up to the next measured count */
+        while (key_count < g_pk_key_counts[i])
+        {
+            val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+
+            key = BENCH_PK_KEY_ID_BASE + 1 + key_count;
+            pk_clear(key);
+            val->crypto_function(VAL_CRYPTO_SET_KEY_ID, &attributes, key);
+            status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, key_data,
+                                          AES_16B_KEY_SIZE, &key);
+            if ((status == PSA_ERROR_INSUFFICIENT_STORAGE) ||
+                (status == PSA_ERROR_INSUFFICIENT_MEMORY))
+            {
+                store_full = TRUE;
+                break;
+            }
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+            /* Keep only the stored copy, as a real key store would after a while */
+            status = val->crypto_function(VAL_CRYPTO_PURGE_KEY, key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+            key_count++;
+        }
+
+        if (store_full == TRUE)
+        {
+            break;
+        }
+
+        val->print(PRINT_TEST, "\tPersistent keys in storage       : %d\n", key_count);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ID, &attributes, BENCH_PK_KEY_ID_BASE);
+        pk_clear(BENCH_PK_KEY_ID_BASE);
+
+        status = pk_measure(&attributes, key_data, AES_16B_KEY_SIZE, TRUE, key_count);
+        if ((status == PSA_ERROR_INSUFFICIENT_STORAGE) ||
+            (status == PSA_ERROR_INSUFFICIENT_MEMORY))
+        {
+            store_full = TRUE;
+            break;
+        }
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+    }
+
+    val->print(PRINT_TEST, "\tMaximum keys stored              : %d", key_count);
+    val->print(PRINT_TEST, (store_full == TRUE) ? " (storage full)\n" :
+                                                  " (BENCH_PK_MAX_KEYS)\n", 0);
+
+    /* Remove the probe key left by a failed lifecycle and the background keys */
+    pk_clear(BENCH_PK_KEY_ID_BASE);
+    for (i = 0; i < key_count; i++)
+    {
+        val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, BENCH_PK_KEY_ID_BASE + 1 + i);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
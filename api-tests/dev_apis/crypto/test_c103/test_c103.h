@@ -0,0 +1,57 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_C103_CLIENT_TESTS_H_
+#define _TEST_C103_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c103)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* First persistent key identifier used by the benchmark, clear of the fixture key range */
+#define BENCH_PK_KEY_ID_BASE       0x3FE00000
+
+/* Largest number of background persistent keys, unless storage runs out first */
+#ifndef BENCH_PK_MAX_KEYS
+#define BENCH_PK_MAX_KEYS          100
+#endif
+
+/* Timed lifecycles of each key type, and of the probe key at every store size */
+#define BENCH_PK_SAMPLES           16
+
+/* Size of the buffer the keys are exported to */
+#define BENCH_PK_EXPORT_SIZE       1024
+
+/* Steps of one persistent key lifecycle */
+typedef enum {
+    BENCH_PK_CREATE = 0,
+    BENCH_PK_WARM_USE,
+    BENCH_PK_PURGE,
+    BENCH_PK_COLD_USE,
+    BENCH_PK_DESTROY,
+    BENCH_PK_OPERATIONS,
+} bench_pk_operation_t;
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c103_crypto_list[];
+
+int32_t psa_persistent_key_lifecycle_test(caller_security_t caller);
+int32_t psa_persistent_key_store_scaling_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C103_CLIENT_TESTS_H_ */
@@ -0,0 +1,72 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_crypto_common.h"
+
+typedef struct {
+    char                    test_desc[75];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+} test_data;
+
+#ifdef ARCH_TEST_AES_128
+static const test_data check1[] = {
+{
+    .test_desc       = "AES 128 bit persistent key\n",
+    .type            = PSA_KEY_TYPE_AES,
+    .data            = key_data,
+    .data_length     = AES_16B_KEY_SIZE,
+},
+
+#ifdef ARCH_TEST_AES_256
+{
+    .test_desc       = "AES 256 bit persistent key\n",
+    .type            = PSA_KEY_TYPE_AES,
+    .data            = key_data,
+    .data_length     = AES_32B_KEY_SIZE,
+},
+#endif
+
+#ifdef ARCH_TEST_HMAC
+{
+    .test_desc       = "HMAC 256 bit persistent key\n",
+    .type            = PSA_KEY_TYPE_HMAC,
+    .data            = key_data,
+    .data_length     = AES_32B_KEY_SIZE,
+},
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+{
+    .test_desc       = "ECC SECP256R1 persistent key pair\n",
+    .type            = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data            = ecdh_secp_256_r1_prv_key,
+    .data_length     = ECDH_SECP_256_R1_PRV_KEY_LEN,
+},
+#endif
+
+#ifdef ARCH_TEST_RSA_1024
+{
+    .test_desc       = "RSA 1024 bit persistent key pair\n",
+    .type            = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data            = rsa_128_key_pair,
+    .data_length     = 610,
+},
+#endif
+};
+#endif
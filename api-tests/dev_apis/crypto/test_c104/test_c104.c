@@ -0,0 +1,161 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c104.h"
+#include "../test_c103/test_data.h"
+
+const client_test_t test_c104_crypto_list[] = {
+    NULL,
+    psa_persistent_key_reset_setup_test,
+    psa_persistent_key_reset_reload_test,
+    NULL,
+};
+
+extern  uint32_t g_test_count;
+
+#ifdef ARCH_TEST_AES_128
+static uint8_t g_pr_export[BENCH_PR_EXPORT_SIZE];
+#endif
+
+int32_t psa_persistent_key_reset_setup_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_AES_128
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                i, status;
+    psa_key_id_t           key;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Store %d persistent keys and reset the system\n", num_checks);
+
+    for (i = 0; i < num_checks; i++)
+    {
+        key = BENCH_PR_KEY_ID_BASE + i;
+
+        /* A key left by an interrupted run is replaced */
+        (void)val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+
+        val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[i].type);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes, PSA_KEY_USAGE_EXPORT);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_LIFETIME, &attributes,
+                             PSA_KEY_LIFETIME_PERSISTENT);
+        val->crypto_function(VAL_CRYPTO_SET_KEY_ID, &attributes, key);
+
+        status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[i].data,
+                                      check1[i].data_length, &key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+    }
+
+    /* Setting boot.state before the reset, check 2 runs after the reboot */
+    if (val->set_boot_flag(BOOT_EXPECTED_REENTER_TEST))
+    {
+        val->print(PRINT_ERROR, "\tFailed to set boot flag before check\n", 0);
+        return VAL_STATUS_ERROR;
+    }
+
+    status = val->crypto_function(VAL_CRYPTO_RESET);
+
+    /* Still running, the target cannot reset itself from the test */
+    if (val->set_boot_flag(BOOT_NOT_EXPECTED))
+    {
+        val->print(PRINT_ERROR, "\tFailed to set boot flag after check\n", 0);
+        return VAL_STATUS_ERROR;
+    }
+
+    for (i = 0; i < num_checks; i++)
+    {
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, BENCH_PR_KEY_ID_BASE + i);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+    }
+
+    val->print(PRINT_TEST, "\tSystem reset is not supported on this target\n", 0);
+    return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
+
+int32_t psa_persistent_key_reset_reload_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_AES_128
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                i, status;
+    uint32_t               start, cold_ns, warm_ns, destroy_ns;
+    psa_key_id_t           key;
+    size_t                 length;
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Test first use of persistent keys after a reset\n", 0);
+
+    /* The first initialization after boot also brings up the key storage */
+    start = val->timestamp_get();
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    val->print(PRINT_TEST, "\tpsa_crypto_init after reset      : %d ns\n",
+               val->timestamp_elapsed(start, val->timestamp_get()));
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        key = BENCH_PR_KEY_ID_BASE + i;
+        val->print(PRINT_TEST, "\t", 0);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key, g_pr_export,
+                                      sizeof(g_pr_export), &length);
+        cold_ns = val->timestamp_elapsed(start, val->timestamp_get());
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* The key survived the reset unchanged */
+        TEST_ASSERT_EQUAL(length, check1[i].data_length, TEST_CHECKPOINT_NUM(3));
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_EXPORT_KEY, key, g_pr_export,
+                                      sizeof(g_pr_export), &length);
+        warm_ns = val->timestamp_elapsed(start, val->timestamp_get());
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+        destroy_ns = val->timestamp_elapsed(start, val->timestamp_get());
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        val->print(PRINT_TEST, "\tpsa_export_key (first after reset): %d ns\n", cold_ns);
+        val->print(PRINT_TEST, "\tpsa_export_key (warm)            : %d ns\n", warm_ns);
+        val->print(PRINT_TEST, "\tpsa_destroy_key                  : %d ns\n", destroy_ns);
+
+        /* Single shot timings, below BENCHMARK_MIN_ITERATIONS unless it is lowered */
+        val->perf_metric("cold_export", i, cold_ns, 1);
+        val->perf_metric("warm_export", i, warm_ns, 1);
+        val->perf_metric("destroy", i, destroy_ns, 1);
+    }
+
+    return VAL_STATUS_SUCCESS;
+#else
+    val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
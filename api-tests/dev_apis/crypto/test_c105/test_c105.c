@@ -0,0 +1,466 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c105.h"
+#include "test_data.h"
+
+const client_test_t test_c105_crypto_list[] = {
+    NULL,
+    psa_concurrent_operation_test,
+    NULL,
+};
+
+extern  uint32_t g_test_count;
+
+/* IV of the cipher contexts, the AEAD contexts use its first 12 bytes as nonce */
+static const uint8_t g_ctx_iv[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+};
+#define BENCH_CTX_NONCE_SIZE       12
+
+/* Names of the PERF metrics, indexed by the number of live contexts */
+static const char g_ctx_metric_name[][16] = {
+    "hash_update", "mac_update", "cipher_update", "aead_update",
+};
+
+static bench_ctx_operation_t g_ctx_operations[BENCH_CTX_MAX_OPS];
+static uint8_t               g_ctx_output[BENCH_CTX_MAX_OPS][BENCH_CTX_OUTPUT_SIZE];
+static size_t                g_ctx_output_length[BENCH_CTX_MAX_OPS];
+
+/* Context i processes the message at offset i, so that neighbouring results differ */
+static uint8_t               g_ctx_input[2 * BENCH_CTX_MESSAGE_SIZE];
+#define CTX_MESSAGE(i)       (g_ctx_input + ((i) % BENCH_CTX_MESSAGE_SIZE))
+
+/**
+    @brief    - Returns the next number of live contexts at which the updates are measured.
+                The counts follow 1-2-5 steps and end at BENCH_CTX_MAX_OPS.
+    @param    - n       : current count, 0 for the first one
+    @return   - next count
+**/
+static uint32_t ctx_next_count(uint32_t n)
+{
+    uint32_t decade = 1, next;
+
+    while ((decade * 10) <= n)
+    {
+        decade *= 10;
+    }
+
+    if (n < decade)
+    {
+        next = decade;
+    }
+    else if (n < (2 * decade))
+    {
+        next = 2 * decade;
+    }
+    else if (n < (5 * decade))
+    {
+        next = 5 * decade;
+    }
+    else
+    {
+        next = 10 * decade;
+    }
+
+    return (next > BENCH_CTX_MAX_OPS) ? BENCH_CTX_MAX_OPS : next;
+}
+
+/**
+    @brief    - Sets up operation context i
+    @param    - data    : operation class and algorithm
+                key     : key of the operation, unused for hash
+                i       : context index
+    @return   - PSA status
+**/
+static int32_t ctx_setup(const test_data *data, psa_key_id_t key, uint32_t i)
+{
+    bench_ctx_operation_t  *operation = &g_ctx_operations[i];
+    int32_t                 status = PSA_ERROR_NOT_SUPPORTED;
+
+    g_ctx_output_length[i] = 0;
+
+    switch (data->op_class)
+    {
+        case BENCH_CTX_HASH:
+            val->crypto_function(VAL_CRYPTO_HASH_OPERATION_INIT, &operation->hash);
+            status = val->crypto_function(VAL_CRYPTO_HASH_SETUP, &operation->hash, data->alg);
+            break;
+        case BENCH_CTX_MAC:
+            val->crypto_function(VAL_CRYPTO_MAC_OPERATION_INIT, &operation->mac);
+            status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_SETUP, &operation->mac, key,
+                                          data->alg);
+            break;
+        case BENCH_CTX_CIPHER:
+            val->crypto_function(VAL_CRYPTO_CIPHER_OPERATION_INIT, &operation->cipher);
+            status = val->crypto_function(VAL_CRYPTO_CIPHER_ENCRYPT_SETUP, &operation->cipher,
+                                          key, data->alg);
+            if (status != PSA_SUCCESS)
+            {
+                break;
+            }
+            status = val->crypto_function(VAL_CRYPTO_CIPHER_SET_IV, &operation->cipher,
+                                          g_ctx_iv, sizeof(g_ctx_iv));
+
+            /* The IV is kept in front of the ciphertext, as psa_cipher_decrypt expects it */
+            memcpy(g_ctx_output[i], g_ctx_iv, sizeof(g_ctx_iv));
+            g_ctx_output_length[i] = sizeof(g_ctx_iv);
+            break;
+        case BENCH_CTX_AEAD:
+            val->crypto_function(VAL_CRYPTO_AEAD_OPERATION_INIT, &operation->aead);
+            status = val->crypto_function(VAL_CRYPTO_AEAD_ENCRYPT_SETUP, &operation->aead,
+                                          key, data->alg);
+            if (status != PSA_SUCCESS)
+            {
+                break;
+            }
+            status = val->crypto_function(VAL_CRYPTO_AEAD_SET_NONCE, &operation->aead,
+                                          g_ctx_iv, BENCH_CTX_NONCE_SIZE);
+            break;
+    }
+
+    return status;
+}
+
+/**
+    @brief    - Feeds the next chunk of its message to operation context i
+    @param    - data    : operation class and algorithm
+                i       : context index
+                round   : index of the chunk
+    @return   - PSA status
+**/
+static int32_t ctx_update(const test_data *data, uint32_t i, uint32_t round)
+{
+    bench_ctx_operation_t  *operation = &g_ctx_operations[i];
+    const uint8_t          *input = CTX_MESSAGE(i) + (round * BENCH_CTX_CHUNK_SIZE);
+    uint8_t                *output = g_ctx_output[i] + g_ctx_output_length[i];
+    size_t                  output_size = BENCH_CTX_OUTPUT_SIZE - g_ctx_output_length[i];
+    size_t                  length = 0;
+    int32_t                 status = PSA_ERROR_NOT_SUPPORTED;
+
+    switch (data->op_class)
+    {
+        case BENCH_CTX_HASH:
+            status = val->crypto_function(VAL_CRYPTO_HASH_UPDATE, &operation->hash, input,
+                                          BENCH_CTX_CHUNK_SIZE);
+            break;
+        case BENCH_CTX_MAC:
+            status = val->crypto_function(VAL_CRYPTO_MAC_UPDATE, &operation->mac, input,
+                                          BENCH_CTX_CHUNK_SIZE);
+            break;
+        case BENCH_CTX_CIPHER:
+            status = val->crypto_function(VAL_CRYPTO_CIPHER_UPDATE, &operation->cipher, input,
+                                          BENCH_CTX_CHUNK_SIZE, output, output_size, &length);
+            break;
+        case BENCH_CTX_AEAD:
+            status = val->crypto_function(VAL_CRYPTO_AEAD_UPDATE, &operation->aead, input,
+                                          BENCH_CTX_CHUNK_SIZE, output, output_size, &length);
+            break;
+    }
+
+    g_ctx_output_length[i] += length;
+    return status;
+}
+
+/**
+    @brief    - Finishes operation context i and appends the result to its output
+    @param    - data    : operation class and algorithm
+                i       : context index
+    @return   - PSA status
+**/
+static int32_t ctx_finish(const test_data *data, uint32_t i)
+{
+    bench_ctx_operation_t  *operation = &g_ctx_operations[i];
+    uint8_t                *output = g_ctx_output[i] + g_ctx_output_length[i];
+    size_t                  output_size = BENCH_CTX_OUTPUT_SIZE - g_ctx_output_length[i];
+    uint8_t                 tag[BENCH_CTX_TAG_SIZE];
+    size_t                  length = 0, tag_length = 0;
+    int32_t                 status = PSA_ERROR_NOT_SUPPORTED;
+
+    switch (data->op_class)
+    {
+        case BENCH_CTX_HASH:
+            status = val->crypto_function(VAL_CRYPTO_HASH_FINISH, &operation->hash, output,
+                                          output_size, &length);
+            break;
+        case BENCH_CTX_MAC:
+            status = val->crypto_function(VAL_CRYPTO_MAC_SIGN_FINISH, &operation->mac, output,
+                                          output_size, &length);
+            break;
+        case BENCH_CTX_CIPHER:
+            status = val->crypto_function(VAL_CRYPTO_CIPHER_FINISH, &operation->cipher, output,
+                                          output_size, &length);
+            break;
+        case BENCH_CTX_AEAD:
+            status = val->crypto_function(VAL_CRYPTO_AEAD_FINISH, &operation->aead, output,
+                                          output_size, &length, tag, sizeof(tag), &tag_length);
+
+            /* psa_aead_encrypt returns the tag after the ciphertext */
+            if ((status == PSA_SUCCESS) && (tag_length <= output_size - length))
+            {
+                memcpy(output + length, tag, tag_length);
+                length += tag_length;
+            }
+            break;
+    }
+
+    g_ctx_output_length[i] += length;
+    return status;
+}
+
+/**
+    @brief    - Aborts operation context i
+    @param    - data    : operation class and algorithm
+                i       : context index
+    @return   - void
+**/
+static void ctx_abort(const test_data *data, uint32_t i)
+{
+    bench_ctx_operation_t  *operation = &g_ctx_operations[i];
+
+    switch (data->op_class)
+    {
+        case BENCH_CTX_HASH:
+            val->crypto_function(VAL_CRYPTO_HASH_ABORT, &operation->hash);
+            break;
+        case BENCH_CTX_MAC:
+            val->crypto_function(VAL_CRYPTO_MAC_ABORT, &operation->mac);
+            break;
+        case BENCH_CTX_CIPHER:
+            val->crypto_function(VAL_CRYPTO_CIPHER_ABORT, &operation->cipher);
+            break;
+        case BENCH_CTX_AEAD:
+            val->crypto_function(VAL_CRYPTO_AEAD_ABORT, &operation->aead);
+            break;
+    }
+}
+
+/**
+    @brief    - Compares the output of operation context i with a single-shot computation
+                on the same message. The cipher output is decrypted instead, as a single
+                shot encryption would pick its own IV.
+    @param    - data    : operation class and algorithm
+                key     : key of the operation, unused for hash
+                i       : context index
+    @return   - val_status_t
+**/
+static int32_t ctx_check(const test_data *data, psa_key_id_t key, uint32_t i)
+{
+    uint8_t                 expected[BENCH_CTX_OUTPUT_SIZE];
+    size_t                  expected_length = 0;
+    int32_t                 status = PSA_ERROR_NOT_SUPPORTED;
+
+    switch (data->op_class)
+    {
+        case BENCH_CTX_HASH:
+            status = val->crypto_function(VAL_CRYPTO_HASH_COMPUTE, data->alg, CTX_MESSAGE(i),
+                                          BENCH_CTX_MESSAGE_SIZE, expected, sizeof(expected),
+                                          &expected_length);
+            break;
+        case BENCH_CTX_MAC:
+            status = val->crypto_function(VAL_CRYPTO_MAC_COMPUTE, key, data->alg,
+                                          CTX_MESSAGE(i), BENCH_CTX_MESSAGE_SIZE, expected,
+                                          sizeof(expected), &expected_length);
+            break;
+        case BENCH_CTX_CIPHER:
+            status = val->crypto_function(VAL_CRYPTO_CIPHER_DECRYPT, key, data->alg,
+                                          g_ctx_output[i], g_ctx_output_length[i], expected,
+                                          sizeof(expected), &expected_length);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+            TEST_ASSERT_EQUAL(expected_length, BENCH_CTX_MESSAGE_SIZE, TEST_CHECKPOINT_NUM(9));
+            TEST_ASSERT_MEMCMP(expected, CTX_MESSAGE(i), expected_length,
+                               TEST_CHECKPOINT_NUM(10));
+            return VAL_STATUS_SUCCESS;
+        case BENCH_CTX_AEAD:
+            status = val->crypto_function(VAL_CRYPTO_AEAD_ENCRYPT, key, data->alg, g_ctx_iv,
+                                          BENCH_CTX_NONCE_SIZE, NULL, 0, CTX_MESSAGE(i),
+                                          BENCH_CTX_MESSAGE_SIZE, expected, sizeof(expected),
+                                          &expected_length);
+            break;
+    }
+
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+    TEST_ASSERT_EQUAL(g_ctx_output_length[i], expected_length, TEST_CHECKPOINT_NUM(9));
+    TEST_ASSERT_MEMCMP(g_ctx_output[i], expected, expected_length, TEST_CHECKPOINT_NUM(10));
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Opens n contexts at once, interleaves their updates round-robin, then
+                finishes and checks each of them
+    @param    - data     : operation class and algorithm
+                key      : key of the operations, unused for hash
+                n        : number of contexts
+                live     : returns the number of contexts that may still hold state and
+                           must be aborted if this step does not succeed
+                total_ns : returns the summed update latency
+    @return   - VAL_STATUS_SUCCESS, PSA_ERROR_INSUFFICIENT_MEMORY once the implementation
+                runs out of contexts, or a failure
+**/
+static int32_t ctx_run(const test_data *data, psa_key_id_t key, uint32_t n, uint32_t *live,
+                       uint64_t *total_ns)
+{
+    int32_t                status;
+    uint32_t               i, round, start;
+
+    /* Open n contexts at once */
+    for (i = 0; i < n; i++)
+    {
+        *live = i + 1;
+        status = ctx_setup(data, key, i);
+        if (status == PSA_ERROR_INSUFFICIENT_MEMORY)
+        {
+            return status;
+        }
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+    }
+
+    /* Interleave the updates round-robin over all live contexts */
+    *total_ns = 0;
+    for (round = 0; round < BENCH_CTX_UPDATES; round++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            start = val->timestamp_get();
+            status = ctx_update(data, i, round);
+            *total_ns += val->timestamp_elapsed(start, val->timestamp_get());
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        }
+    }
+
+    for (i = 0; i < n; i++)
+    {
+        status = ctx_finish(data, i);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+        status = ctx_check(data, key, i);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            val->print(PRINT_ERROR, "\tContext %d of ", i);
+            val->print(PRINT_ERROR, "%d differs from the single-shot result\n", n);
+            return status;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t psa_concurrent_operation_test(caller_security_t caller __UNUSED)
+{
+    int32_t                num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t                j, status;
+    uint32_t               i, n, live, max_ops;
+    uint64_t               total_ns;
+    bool_t                 out_of_memory;
+    psa_key_id_t           key = 0;
+    psa_key_attributes_t   attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    if (num_checks == 0)
+    {
+        val->print(PRINT_TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    for (i = 0; i < sizeof(g_ctx_input); i++)
+    {
+        g_ctx_input[i] = (uint8_t)((i * 7) + 1);
+    }
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (j = 0; j < num_checks; j++)
+    {
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[j].test_desc, 0);
+
+        if (check1[j].type != PSA_KEY_TYPE_NONE)
+        {
+            /* Setup the attributes for the key */
+            val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE, &attributes, check1[j].type);
+            val->crypto_function(VAL_CRYPTO_SET_KEY_USAGE_FLAGS, &attributes,
+                                 check1[j].usage_flags);
+            val->crypto_function(VAL_CRYPTO_SET_KEY_ALGORITHM, &attributes, check1[j].alg);
+
+            status = val->crypto_function(VAL_CRYPTO_IMPORT_KEY, &attributes, check1[j].data,
+                                          check1[j].data_length, &key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+        }
+
+        max_ops = 0;
+        out_of_memory = FALSE;
+        n = 0;
+
+        do
+        {
+            n = ctx_next_count(n);
+            val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+
+            live = 0;
+            total_ns = 0;
+            status = ctx_run(&check1[j], key, n, &live, &total_ns);
+            if (status != VAL_STATUS_SUCCESS)
+            {
+                /* Release every context that may hold state, so that none leaks into
+                   the later checks and tests */
+                for (i = 0; i < live; i++)
+                {
+                    ctx_abort(&check1[j], i);
+                }
+
+                if (status != PSA_ERROR_INSUFFICIENT_MEMORY)
+                {
+                    return status;
+                }
+
+                /* live - 1 contexts were open when the implementation ran out of memory */
+                out_of_memory = TRUE;
+                max_ops = live - 1;
+                break;
+            }
+
+            val->print(PRINT_TEST, "\tLive contexts : %d", n);
+            val->print(PRINT_TEST, ", update : %d ns\n",
+                       (int32_t)(total_ns / (n * BENCH_CTX_UPDATES)));
+            val->perf_metric(g_ctx_metric_name[check1[j].op_class], n,
+                             (uint32_t)(total_ns / (n * BENCH_CTX_UPDATES)),
+                             n * BENCH_CTX_UPDATES);
+            max_ops = n;
+        } while (n < BENCH_CTX_MAX_OPS);
+
+        val->print(PRINT_TEST, "\tMaximum live contexts : %d", max_ops);
+        val->print(PRINT_TEST, (out_of_memory == TRUE) ? " (PSA_ERROR_INSUFFICIENT_MEMORY)\n" :
+                                                         " (BENCH_CTX_MAX_OPS)\n", 0);
+
+        if (check1[j].type != PSA_KEY_TYPE_NONE)
+        {
+            status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+            val->crypto_function(VAL_CRYPTO_RESET_KEY_ATTRIBUTES, &attributes);
+        }
+
+        /* At least one context must always be possible */
+        TEST_ASSERT_NOT_EQUAL(max_ops, 0, TEST_CHECKPOINT_NUM(7));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
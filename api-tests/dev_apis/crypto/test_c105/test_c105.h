@@ -0,0 +1,68 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_C105_CLIENT_TESTS_H_
+#define _TEST_C105_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c105)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* Largest number of live operation contexts, unless the implementation runs out first */
+#ifndef BENCH_CTX_MAX_OPS
+#define BENCH_CTX_MAX_OPS          128
+#endif
+
+/* Updates made on every context, interleaved round-robin over all live contexts */
+#define BENCH_CTX_UPDATES          4
+
+/* Input bytes passed to each update */
+#define BENCH_CTX_CHUNK_SIZE       16
+
+/* Message processed by each context */
+#define BENCH_CTX_MESSAGE_SIZE     (BENCH_CTX_UPDATES * BENCH_CTX_CHUNK_SIZE)
+
+/* Largest AEAD tag, the full GCM tag */
+#define BENCH_CTX_TAG_SIZE         16
+
+/* Output of each context, with room for a prepended IV or an appended tag */
+#define BENCH_CTX_OUTPUT_SIZE      (BENCH_CTX_MESSAGE_SIZE + 32)
+
+/* Multipart operation classes held open at the same time */
+typedef enum {
+    BENCH_CTX_HASH = 0,
+    BENCH_CTX_MAC,
+    BENCH_CTX_CIPHER,
+    BENCH_CTX_AEAD,
+} bench_ctx_class_t;
+
+/* One live operation context of any class */
+typedef union {
+    psa_hash_operation_t    hash;
+    psa_mac_operation_t     mac;
+    psa_cipher_operation_t  cipher;
+    psa_aead_operation_t    aead;
+} bench_ctx_operation_t;
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c105_crypto_list[];
+
+int32_t psa_concurrent_operation_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C105_CLIENT_TESTS_H_ */
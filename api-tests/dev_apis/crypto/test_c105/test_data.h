@@ -0,0 +1,78 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_crypto_common.h"
+
+typedef struct {
+    char                    test_desc[75];
+    bench_ctx_class_t       op_class;
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_key_usage_t         usage_flags;
+    psa_algorithm_t         alg;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc       = "Test concurrent psa_hash_operation_t - SHA 256\n",
+    .op_class        = BENCH_CTX_HASH,
+    .type            = PSA_KEY_TYPE_NONE,
+    .data            = NULL,
+    .data_length     = 0,
+    .usage_flags     = 0,
+    .alg             = PSA_ALG_SHA_256,
+},
+#endif
+
+#if defined(ARCH_TEST_HMAC) && defined(ARCH_TEST_SHA256)
+{
+    .test_desc       = "Test concurrent psa_mac_operation_t - HMAC SHA 256\n",
+    .op_class        = BENCH_CTX_MAC,
+    .type            = PSA_KEY_TYPE_HMAC,
+    .data            = key_data,
+    .data_length     = AES_32B_KEY_SIZE,
+    .usage_flags     = PSA_KEY_USAGE_SIGN_HASH,
+    .alg             = PSA_ALG_HMAC(PSA_ALG_SHA_256),
+},
+#endif
+
+#if defined(ARCH_TEST_CIPHER_MODE_CTR) && defined(ARCH_TEST_AES_128)
+{
+    .test_desc       = "Test concurrent psa_cipher_operation_t - AES CTR\n",
+    .op_class        = BENCH_CTX_CIPHER,
+    .type            = PSA_KEY_TYPE_AES,
+    .data            = key_data,
+    .data_length     = AES_16B_KEY_SIZE,
+    .usage_flags     = PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT,
+    .alg             = PSA_ALG_CTR,
+},
+#endif
+
+#if defined(ARCH_TEST_GCM) && defined(ARCH_TEST_AES_128)
+{
+    .test_desc       = "Test concurrent psa_aead_operation_t - AES GCM\n",
+    .op_class        = BENCH_CTX_AEAD,
+    .type            = PSA_KEY_TYPE_AES,
+    .data            = key_data,
+    .data_length     = AES_16B_KEY_SIZE,
+    .usage_flags     = PSA_KEY_USAGE_ENCRYPT,
+    .alg             = PSA_ALG_GCM,
+},
+#endif
+};
@@ -0,0 +1,355 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_c106.h"
+
+const client_test_t test_c106_crypto_list[] = {
+    NULL,
+    psa_generate_random_throughput_test,
+    psa_generate_random_health_test,
+    NULL,
+};
+
+extern  uint32_t g_test_count;
+
+/* Request sizes at which the throughput is measured */
+static const uint32_t g_rng_request_sizes[] = {
+    1, 16, 64, 256, 1024, BENCH_RNG_MAX_REQUEST,
+};
+
+static uint8_t     g_rng_buffer[BENCH_RNG_MAX_REQUEST];
+static rng_stats_t g_rng_stats;
+
+/**
+    @brief    - Square root by Newton iteration, the test suite is not linked with libm
+    @param    - x : non-negative value
+    @return   - square root of x
+**/
+static double rng_sqrt(double x)
+{
+    double r = (x > 1) ? x : 1;
+    int    i;
+
+    for (i = 0; i < 64; i++)
+    {
+        r = (r + x / r) / 2;
+    }
+    return r;
+}
+
+/**
+    @brief    - Shifts one bit into the approximate entropy window and counts the 3 and 4
+                bit patterns ending at it
+    @param    - stats : statistics state
+                bit   : next bit of the stream
+    @return   - void
+**/
+static void rng_window_push(rng_stats_t *stats, uint32_t bit)
+{
+    stats->window = ((stats->window << 1) | bit) & 0xF;
+    if (stats->bits >= 3)
+    {
+        stats->count4[stats->window]++;
+        stats->count3[stats->window & 0x7]++;
+    }
+}
+
+/**
+    @brief    - Feeds random bytes to the streaming statistical checks
+    @param    - stats  : statistics state
+                buffer : random bytes
+                length : number of bytes
+    @return   - void
+**/
+static void rng_stats_update(rng_stats_t *stats, const uint8_t *buffer, size_t length)
+{
+    size_t      i;
+    int32_t     k;
+    uint32_t    bit;
+    uint8_t     byte;
+
+    for (i = 0; i < length; i++)
+    {
+        byte = buffer[i];
+
+        if (stats->bits == 0)
+        {
+            stats->first_byte = byte;
+        }
+
+        /* SP 800-90B repetition count test on byte samples */
+        if ((stats->bits != 0) && (byte == stats->rct_value))
+        {
+            stats->rct_count++;
+            if (stats->rct_count == BENCH_RNG_RCT_CUTOFF)
+            {
+                stats->rct_failures++;
+            }
+        }
+        else
+        {
+            stats->rct_value = byte;
+            stats->rct_count = 1;
+        }
+        if (stats->rct_count > stats->rct_max)
+        {
+            stats->rct_max = stats->rct_count;
+        }
+
+        /* SP 800-90B adaptive proportion test on byte samples */
+        if (stats->apt_index == 0)
+        {
+            stats->apt_value = byte;
+            stats->apt_count = 1;
+        }
+        else if (byte == stats->apt_value)
+        {
+            stats->apt_count++;
+        }
+        if (++stats->apt_index == BENCH_RNG_APT_WINDOW)
+        {
+            if (stats->apt_count >= BENCH_RNG_APT_CUTOFF)
+            {
+                stats->apt_failures++;
+            }
+            if (stats->apt_count > stats->apt_max)
+            {
+                stats->apt_max = stats->apt_count;
+            }
+            stats->apt_index = 0;
+        }
+
+        /* Monobit, runs and approximate entropy work on the bits, MSB first */
+        for (k = 7; k >= 0; k--)
+        {
+            bit = (byte >> k) & 0x1;
+            stats->ones += bit;
+            if ((stats->bits != 0) && (bit != stats->last_bit))
+            {
+                stats->transitions++;
+            }
+            stats->last_bit = (uint8_t)bit;
+            rng_window_push(stats, bit);
+            stats->bits++;
+        }
+    }
+}
+
+/**
+    @brief    - Serial test statistic psi^2 of the m bit patterns
+    @param    - count : number of occurrences of each pattern
+                m     : pattern length in bits
+                n     : number of patterns counted
+    @return   - psi^2
+**/
+static double rng_psi2(const uint64_t *count, uint32_t m, uint64_t n)
+{
+    double      sum = 0, dev;
+    uint32_t    i, patterns = 1u << m;
+
+    for (i = 0; i < patterns; i++)
+    {
+        dev = (double)count[i] * patterns - (double)n;
+        sum += dev * dev;
+    }
+    return sum / ((double)patterns * (double)n);
+}
+
+/**
+    @brief    - Completes the statistical checks and prints their results
+    @param    - stats : statistics state, left unusable for further updates
+    @return   - number of failed checks
+**/
+static uint32_t rng_stats_report(rng_stats_t *stats)
+{
+    double      n = (double)stats->bits, s, pi, tau, runs, z, chi;
+    uint64_t    patterns = stats->bits;
+    uint32_t    failures = 0;
+    int32_t     k;
+
+    /* Frequency (monobit) test, SP 800-22 2.1 */
+    s = (2 * (double)stats->ones) - n;
+    z = ((s < 0) ? -s : s) / rng_sqrt(n);
+    val->print(PRINT_TEST, "\tMonobit |z| x 100              : %d", (int32_t)(z * 100));
+    if ((z * 100) >= BENCH_RNG_Z_LIMIT)
+    {
+        val->print(PRINT_ERROR, " (limit %d)", BENCH_RNG_Z_LIMIT);
+        failures++;
+    }
+    val->print(PRINT_TEST, "\n", 0);
+
+    /* Runs test, SP 800-22 2.3, only meaningful when the monobit test passed */
+    pi   = (double)stats->ones / n;
+    tau  = 2 / rng_sqrt(n);
+    runs = (double)stats->transitions + 1;
+    if (((pi - 0.5) >= tau) || ((0.5 - pi) >= tau))
+    {
+        val->print(PRINT_TEST, "\tRuns test                      : not applicable\n", 0);
+    }
+    else
+    {
+        z = runs - (2 * n * pi * (1 - pi));
+        z = ((z < 0) ? -z : z) / (2 * rng_sqrt(2 * n) * pi * (1 - pi));
+        val->print(PRINT_TEST, "\tRuns |z| x 100                 : %d", (int32_t)(z * 100));
+        if ((z * 100) >= BENCH_RNG_Z_LIMIT)
+        {
+            val->print(PRINT_ERROR, " (limit %d)", BENCH_RNG_Z_LIMIT);
+            failures++;
+        }
+        val->print(PRINT_TEST, "\n", 0);
+    }
+
+    /* Approximate entropy test, SP 800-22 2.12, with m = 3. The patterns wrap around
+       the end of the stream. 2n(ln 2 - ApEn) is evaluated through its serial test
+       approximation psi^2(4) - psi^2(3), which needs no logarithm */
+    for (k = 7; k >= 5; k--)
+    {
+        rng_window_push(stats, (stats->first_byte >> k) & 0x1);
+        stats->bits++;
+    }
+    chi = rng_psi2(stats->count4, 4, patterns) - rng_psi2(stats->count3, 3, patterns);
+    val->print(PRINT_TEST, "\tApproximate entropy chi2 x 100 : %d", (int32_t)(chi * 100));
+    if ((chi * 100) >= BENCH_RNG_APEN_LIMIT)
+    {
+        val->print(PRINT_ERROR, " (limit %d)", BENCH_RNG_APEN_LIMIT);
+        failures++;
+    }
+    val->print(PRINT_TEST, "\n", 0);
+
+    /* SP 800-90B health tests */
+    val->print(PRINT_TEST, "\tLongest repeated byte run      : %d", stats->rct_max);
+    if (stats->rct_failures != 0)
+    {
+        val->print(PRINT_ERROR, " (%d repetition count alarms)", stats->rct_failures);
+        failures++;
+    }
+    val->print(PRINT_TEST, "\n", 0);
+
+    val->print(PRINT_TEST, "\tMost frequent byte per window  : %d", stats->apt_max);
+    if (stats->apt_failures != 0)
+    {
+        val->print(PRINT_ERROR, " (%d adaptive proportion alarms)", stats->apt_failures);
+        failures++;
+    }
+    val->print(PRINT_TEST, "\n", 0);
+
+    return failures;
+}
+
+int32_t psa_generate_random_throughput_test(caller_security_t caller __UNUSED)
+{
+    int32_t     status;
+    uint32_t    i, call, calls, size, start, num_sizes;
+    uint32_t    call_ns, first_call_ns = 0, byte_ns_x1000 = 0;
+    uint64_t    total_ns, total_bytes = (uint64_t)BENCH_RNG_TOTAL_KB * 1024;
+
+    num_sizes = sizeof(g_rng_request_sizes)/sizeof(g_rng_request_sizes[0]);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Test psa_generate_random throughput, up to %d KB per size\n",
+               BENCH_RNG_TOTAL_KB);
+
+    for (i = 0; i < num_sizes; i++)
+    {
+        size  = g_rng_request_sizes[i];
+        calls = (uint32_t)(total_bytes / size);
+        calls = (calls > BENCH_RNG_MAX_CALLS) ? BENCH_RNG_MAX_CALLS : calls;
+        calls = (calls == 0) ? 1 : calls;
+
+        total_ns = 0;
+        for (call = 0; call < calls; call++)
+        {
+            if ((call % BENCH_RNG_WD_INTERVAL) == 0)
+            {
+                val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            }
+
+            start = val->timestamp_get();
+            status = val->crypto_function(VAL_CRYPTO_GENERATE_RANDOM, g_rng_buffer, size);
+            total_ns += val->timestamp_elapsed(start, val->timestamp_get());
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+        }
+
+        call_ns = (uint32_t)(total_ns / calls);
+        if (i == 0)
+        {
+            first_call_ns = call_ns;
+        }
+        byte_ns_x1000 = (uint32_t)((total_ns * 1000) / ((uint64_t)calls * size));
+
+        val->print(PRINT_TEST, "\tRequest of %d bytes", size);
+        val->print(PRINT_TEST, " : %d ns per call", call_ns);
+        val->print(PRINT_TEST, ", %d KB/s\n", (total_ns == 0) ? 0 :
+                   (int32_t)(((uint64_t)calls * size * 1000000000) / (1024 * total_ns)));
+        val->perf_metric("generate_random", size, call_ns, calls);
+    }
+
+    /* The per-byte cost of the largest requests, taken out of the smallest request */
+    val->print(PRINT_TEST, "\tRequest overhead               : %d ns\n",
+               (int32_t)(first_call_ns - ((g_rng_request_sizes[0] * byte_ns_x1000) / 1000)));
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t psa_generate_random_health_test(caller_security_t caller __UNUSED)
+{
+    int32_t     status;
+    uint32_t    call, calls, start, failures;
+    uint64_t    total_ns = 0;
+
+    calls = (uint32_t)(((uint64_t)BENCH_RNG_TOTAL_KB * 1024) / BENCH_RNG_STATS_REQUEST);
+    memset(&g_rng_stats, 0, sizeof(g_rng_stats));
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto_function(VAL_CRYPTO_INIT);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+    val->print(PRINT_TEST, "Test statistical quality of %d KB of psa_generate_random output\n",
+               BENCH_RNG_TOTAL_KB);
+
+    for (call = 0; call < calls; call++)
+    {
+        if ((call % BENCH_RNG_WD_INTERVAL) == 0)
+        {
+            val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        }
+
+        start = val->timestamp_get();
+        status = val->crypto_function(VAL_CRYPTO_GENERATE_RANDOM, g_rng_buffer,
+                                      BENCH_RNG_STATS_REQUEST);
+        total_ns += val->timestamp_elapsed(start, val->timestamp_get());
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        rng_stats_update(&g_rng_stats, g_rng_buffer, BENCH_RNG_STATS_REQUEST);
+    }
+
+    val->print(PRINT_TEST, "\tGeneration rate                : %d KB/s\n", (total_ns == 0) ? 0 :
+               (int32_t)(((uint64_t)calls * BENCH_RNG_STATS_REQUEST * 1000000000) /
+               (1024 * total_ns)));
+
+    failures = rng_stats_report(&g_rng_stats);
+    TEST_ASSERT_EQUAL(failures, 0, TEST_CHECKPOINT_NUM(3));
+
+    return VAL_STATUS_SUCCESS;
+}
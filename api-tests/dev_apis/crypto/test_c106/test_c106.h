@@ -0,0 +1,85 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _TEST_C106_CLIENT_TESTS_H_
+#define _TEST_C106_CLIENT_TESTS_H_
+
+#include "val_crypto.h"
+#define test_entry CONCAT(test_entry_, c106)
+#define val CONCAT(val, test_entry)
+#define psa CONCAT(psa, test_entry)
+
+/* Random bytes pulled through psa_generate_random by each check, in KB. Targets can
+   set a larger volume in pal_crypto_config.h */
+#ifndef BENCH_RNG_TOTAL_KB
+#define BENCH_RNG_TOTAL_KB         1024
+#endif
+
+/* Largest request size, also the size of the output buffer */
+#define BENCH_RNG_MAX_REQUEST      4096
+
+/* Most calls timed at one request size, bounding the time spent on small requests */
+#define BENCH_RNG_MAX_CALLS        65536
+
+/* Request size used to feed the statistical checks */
+#define BENCH_RNG_STATS_REQUEST    1024
+
+/* Number of calls between two watchdog reprograms */
+#define BENCH_RNG_WD_INTERVAL      1024
+
+/* |z| x 100 limit of the monobit and runs tests, two-sided alpha = 0.001 */
+#define BENCH_RNG_Z_LIMIT          329
+
+/* Chi-square x 100 limit of the approximate entropy test, 8 degrees of freedom,
+   alpha = 0.001 */
+#define BENCH_RNG_APEN_LIMIT       2612
+
+/* SP 800-90B repetition count and adaptive proportion cutoffs for byte samples of
+   full entropy, alpha = 2^-40 so that hundreds of MB do not raise false alarms */
+#define BENCH_RNG_RCT_CUTOFF       6
+#define BENCH_RNG_APT_WINDOW       512
+#define BENCH_RNG_APT_CUTOFF       20
+
+/* Running state of the statistical checks, the random bytes themselves are not kept */
+typedef struct {
+    uint64_t    bits;
+    uint64_t    ones;
+    uint64_t    transitions;
+    uint64_t    count3[8];
+    uint64_t    count4[16];
+    uint32_t    window;
+    uint8_t     first_byte;
+    uint8_t     last_bit;
+    uint8_t     rct_value;
+    uint32_t    rct_count;
+    uint32_t    rct_max;
+    uint32_t    rct_failures;
+    uint8_t     apt_value;
+    uint32_t    apt_index;
+    uint32_t    apt_count;
+    uint32_t    apt_max;
+    uint32_t    apt_failures;
+} rng_stats_t;
+
+extern val_api_t *val;
+extern psa_api_t *psa;
+extern const client_test_t test_c106_crypto_list[];
+
+int32_t psa_generate_random_throughput_test(caller_security_t caller);
+int32_t psa_generate_random_health_test(caller_security_t caller);
+extern void crypto_common_exit_action(void);
+
+#endif /* _TEST_C106_CLIENT_TESTS_H_ */
@@ -0,0 +1,117 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i091.h"
+
+const client_test_t test_i091_client_tests_list[] = {
+    NULL,
+    client_test_doorbell_latency,
+    client_test_irq_latency,
+    NULL,
+};
+
+/*
+ * The signal latency measurement is captured in driver_partition.c as this is the
+ * only partition in test suite that holds the interrupt source. The measurement is
+ * invoked by client by calling to DRIVER_TEST_SID RoT service of driver partition
+ * and the result is returned in out_vec.
+ */
+static int32_t measure_signal_latency(driver_test_fn_id_t driver_test_fn_id)
+{
+#if PLATFORM_PSA_ISOLATION_LEVEL > 2
+   /* The timestamp counter (SysTick on the reference targets) sits in the Private
+    * Peripheral Bus, which only privileged code can access. At isolation level 3 the
+    * driver partition runs unprivileged and can't read it.
+    */
+   (void)driver_test_fn_id;
+   val->print(PRINT_ERROR, "\tSkipping test as timestamp needs a privileged driver partition\n", 0);
+   return RESULT_SKIP(VAL_STATUS_ISOLATION_LEVEL_NOT_SUPP);
+#else
+   latency_stats_t        stats = {0};
+   uint32_t               iterations = LATENCY_ITERATIONS;
+   psa_status_t           status;
+#if STATELESS_ROT != 1
+   psa_handle_t           handle;
+#endif
+
+   psa_invec invec[2] = {{&driver_test_fn_id, sizeof(driver_test_fn_id)},
+                         {&iterations, sizeof(iterations)}};
+   psa_outvec outvec[1] = {{&stats, sizeof(stats)}};
+
+#if STATELESS_ROT == 1
+   status = psa->call(DRIVER_TEST_HANDLE, PSA_IPC_CALL, invec, 2, outvec, 1);
+#else
+   /* Connect to DRIVER_TEST_SID */
+   handle = psa->connect(DRIVER_TEST_SID, DRIVER_TEST_VERSION);
+   if (!PSA_HANDLE_IS_VALID(handle))
+   {
+       val->print(PRINT_ERROR, "\t psa_connect failed. handle=0x%x\n", handle);
+       return VAL_STATUS_SPM_FAILED;
+   }
+
+   status = psa->call(handle, PSA_IPC_CALL, invec, 2, outvec, 1);
+   psa->close(handle);
+#endif
+
+   if (status != PSA_SUCCESS)
+   {
+       val->print(PRINT_ERROR, "\tLatency measurement failed, status=0x%x\n", status);
+       return VAL_STATUS_SPM_FAILED;
+   }
+
+   if ((stats.iterations != iterations) || (stats.min_ticks > stats.max_ticks))
+   {
+       val->print(PRINT_ERROR, "\tInconsistent latency report\n", 0);
+       return VAL_STATUS_DATA_MISMATCH;
+   }
+
+   val->print(PRINT_ALWAYS, "\tIterations      : %d\n", stats.iterations);
+   val->print(PRINT_ALWAYS, "\tMin (ticks)     : %d\n", stats.min_ticks);
+   val->print(PRINT_ALWAYS, "\tAvg (ticks)     : %d\n", stats.avg_ticks);
+   val->print(PRINT_ALWAYS, "\tMax (ticks)     : %d\n", stats.max_ticks);
+   if (stats.ticks_per_us)
+   {
+       val->print(PRINT_ALWAYS, "\tMin (us)        : %d\n", stats.min_ticks / stats.ticks_per_us);
+       val->print(PRINT_ALWAYS, "\tAvg (us)        : %d\n", stats.avg_ticks / stats.ticks_per_us);
+       val->print(PRINT_ALWAYS, "\tMax (us)        : %d\n", stats.max_ticks / stats.ticks_per_us);
+   }
+
+   return VAL_STATUS_SUCCESS;
+#endif
+}
+
+int32_t client_test_doorbell_latency(caller_security_t caller __UNUSED)
+{
+   val->print(PRINT_TEST, "[Check 1] Test psa_notify to psa_wait doorbell latency\n", 0);
+
+   return measure_signal_latency(TEST_DOORBELL_LATENCY);
+}
+
+int32_t client_test_irq_latency(caller_security_t caller __UNUSED)
+{
+   val->print(PRINT_TEST, "[Check 2] Test interrupt to psa_wait irq signal latency\n", 0);
+
+   return measure_signal_latency(TEST_INTR_LATENCY);
+}
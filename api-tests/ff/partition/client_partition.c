@@ -77,6 +77,10 @@ void client_main(void)
                     {
                         psa_write(msg.handle, 0, &test_status, sizeof(test_status));
                         psa_reply(msg.handle, PSA_SUCCESS);
+                        /* Result is consumed, the connection may be reused for
+                         * the next handshake */
+                        test_data = 0;
+                        test_status = 0;
                     }
                     else
                     {
@@ -18,6 +18,7 @@
 #include "val_driver_service_apis.h"
 #define DATA_VALUE  0x1111
 #define BUFFER_SIZE 4
+#define LATENCY_DEFAULT_ITERATIONS 100
 
 #if SPEC_VERSION == 11
 
@@ -31,6 +32,7 @@ int32_t driver_test_psa_eoi_with_non_intr_signal(void);
 int32_t driver_test_psa_eoi_with_unasserted_signal(void);
 int32_t driver_test_psa_eoi_with_multiple_signals(void);
 int32_t driver_test_irq_routing(void);
+int32_t driver_test_signal_latency(psa_msg_t *msg, driver_test_fn_id_t driver_test_fn_id);
 void driver_test_isolation_psa_rot_data_rd(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_data_wr(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_stack_rd(psa_msg_t *msg);
@@ -264,6 +266,14 @@ void driver_main(void)
                              else
                                  psa_reply(msg.handle, PSA_SUCCESS);
                              break;
+                        case TEST_DOORBELL_LATENCY:
+                        case TEST_INTR_LATENCY:
+                             if (driver_test_signal_latency(&msg, driver_test_fn_id)
+                                 != VAL_STATUS_SUCCESS)
+                                 psa_reply(msg.handle, VAL_STATUS_ERROR);
+                             else
+                                 psa_reply(msg.handle, PSA_SUCCESS);
+                             break;
                         case TEST_ISOLATION_PSA_ROT_DATA_RD:
                              driver_test_isolation_psa_rot_data_rd(&msg);
                              break;
@@ -448,6 +458,105 @@ int32_t driver_test_irq_routing(void)
     }
 }
 
+/*
+ * Measures the time from raising a signal to psa_wait() observing it:
+ *  - TEST_DOORBELL_LATENCY: psa_notify() to PSA_DOORBELL being returned by psa_wait()
+ *  - TEST_INTR_LATENCY: interrupt assertion to DRIVER_UART_INTR_SIG being returned by psa_wait()
+ * in_vec[1] optionally carries the iteration count, the min/avg/max result is
+ * written to out_vec[0] as latency_stats_t.
+ * The reference targets timestamp with SysTick. It sits in the Private Peripheral
+ * Bus, which the MPU doesn't cover, so it can't be granted through mmio_regions in
+ * the manifest. Access relies on this PSA-RoT partition running privileged, as it
+ * does at isolation level 1 and 2. test_i091 skips at isolation level 3.
+ */
+int32_t driver_test_signal_latency(psa_msg_t *msg, driver_test_fn_id_t driver_test_fn_id)
+{
+    latency_stats_t  stats = {0};
+    uint32_t         iterations = LATENCY_DEFAULT_ITERATIONS;
+    uint64_t         total_ticks = 0;
+    uint32_t         start, elapsed, i;
+    psa_signal_t     signal, signals;
+
+    if (msg->in_size[1] == sizeof(iterations))
+    {
+        psa_read(msg->handle, 1, &iterations, sizeof(iterations));
+    }
+
+    if ((iterations == 0) || (msg->out_size[0] < sizeof(stats)))
+    {
+        val_print_sf("\tInvalid latency test parameters\n", 0);
+        return VAL_STATUS_INVALID;
+    }
+
+    if (driver_test_fn_id == TEST_DOORBELL_LATENCY)
+    {
+        signal = PSA_DOORBELL;
+    }
+    else
+    {
+        signal = DRIVER_UART_INTR_SIG;
+        psa_irq_enable(DRIVER_UART_INTR_SIG);
+    }
+
+    val_timestamp_init_sf();
+    stats.min_ticks = UINT32_MAX;
+
+    for (i = 0; i < iterations; i++)
+    {
+        start = val_timestamp_get_sf();
+
+        if (signal == PSA_DOORBELL)
+        {
+            /* Doorbell to own partition */
+            psa_notify(DRIVER_PARTITION);
+        }
+        else
+        {
+            /* Assert interrupt signal assigned to driver partition */
+            val_generate_interrupt();
+        }
+
+        signals = psa_wait(signal, PSA_BLOCK);
+        elapsed = val_timestamp_elapsed_sf(start, val_timestamp_get_sf());
+
+        if (signal == PSA_DOORBELL)
+        {
+            psa_clear();
+        }
+        else
+        {
+            val_disable_interrupt();
+            if (signals & signal)
+            {
+                psa_eoi(signal);
+            }
+        }
+
+        if ((signals & signal) == 0)
+        {
+            val_print_sf("\tFailed to receive signal, signals=0x%x\n", signals);
+            return VAL_STATUS_SPM_FAILED;
+        }
+
+        total_ticks += elapsed;
+        if (elapsed < stats.min_ticks)
+        {
+            stats.min_ticks = elapsed;
+        }
+        if (elapsed > stats.max_ticks)
+        {
+            stats.max_ticks = elapsed;
+        }
+    }
+
+    stats.iterations   = iterations;
+    stats.avg_ticks    = (uint32_t)(total_ticks / iterations);
+    stats.ticks_per_us = val_timestamp_ticks_per_us_sf();
+
+    psa_write(msg->handle, 0, &stats, sizeof(stats));
+    return VAL_STATUS_SUCCESS;
+}
+
 static int32_t process_call_request(psa_signal_t sig, psa_msg_t *msg)
 {
     val_status_t res = VAL_STATUS_ERROR;
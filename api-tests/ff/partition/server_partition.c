@@ -80,6 +80,10 @@ void server_main(void)
                         val_print(PRINT_INFO,"\tSERVER TEST FUNC END\n", 0);
                         psa_write(msg.handle, 0, &test_status, msg.out_size[0]);
                         psa_reply(msg.handle, PSA_SUCCESS);
+                        /* Result is consumed, the connection may be reused for
+                         * the next handshake */
+                        test_data = 0;
+                        test_status = 0;
                     }
                     else
                     {
@@ -0,0 +1,111 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_systick.h"
+
+/* Reload value the counter runs with, it counts down from here to 0 */
+static uint32_t g_systick_reload = SYSTICK_COUNTER_MAX;
+
+/* Set when pal_systick_init started the counter, which may then be restarted */
+static uint32_t g_systick_owned = 0;
+
+/**
+    @brief    - This function starts SysTick as a free running counter clocked
+                from the processor clock. The SysTick exception is not enabled.
+    @param    - void
+    @return   - void
+**/
+void pal_systick_init(void)
+{
+    systick_t *systick = (systick_t *)SYSTICK_BASE;
+
+    if (systick->CTRL & SYSTICK_CTRL_ENABLE_Msk)
+    {
+        /* Already running, for example as the RTOS tick. Keep its reload value, the
+           counter wraps every LOAD + 1 ticks rather than every 2^24 */
+        g_systick_reload = systick->LOAD & SYSTICK_COUNTER_MAX;
+        g_systick_owned  = 0;
+        return;
+    }
+
+    g_systick_reload = SYSTICK_COUNTER_MAX;
+    g_systick_owned  = 1;
+    systick->LOAD = SYSTICK_COUNTER_MAX;
+    systick->VAL  = 0;
+    systick->CTRL = SYSTICK_CTRL_CLKSOURCE_Msk | SYSTICK_CTRL_ENABLE_Msk;
+}
+
+/**
+    @brief    - This function returns the current counter value converted to an
+                up counter so that later timestamps have larger values
+    @param    - void
+    @return   - counter value in processor clock ticks
+**/
+uint32_t pal_systick_get_count(void)
+{
+    return (g_systick_reload - (((systick_t *)SYSTICK_BASE)->VAL & SYSTICK_COUNTER_MAX));
+}
+
+/**
+    @brief    - This function returns the number of ticks between two counter values,
+                accounting for a single counter wrap
+    @param    - start   : counter value taken first
+                end     : counter value taken last
+    @return   - elapsed ticks
+**/
+uint32_t pal_systick_elapsed(uint32_t start, uint32_t end)
+{
+    if (end >= start)
+    {
+        return (end - start);
+    }
+    return (end + (g_systick_reload + 1) - start);
+}
+
+/**
+    @brief    - This function clears COUNTFLAG to start a wrap check. A counter started
+                by pal_systick_init is also restarted from its reload value, so that
+                COUNTFLAG is only set again after a full period. Counter values taken
+                before the restart must not be compared with later ones.
+    @param    - void
+    @return   - void
+**/
+void pal_systick_restart(void)
+{
+    systick_t *systick = (systick_t *)SYSTICK_BASE;
+
+    if (g_systick_owned)
+    {
+        /* Any write clears the counter and COUNTFLAG, the counter reloads on the next tick */
+        systick->VAL = 0;
+    }
+
+    /* Reading CTRL clears COUNTFLAG */
+    (void)systick->CTRL;
+}
+
+/**
+    @brief    - This function returns whether the counter reached zero since
+                pal_systick_restart. After a restart of an owned counter that takes a
+                full period; a counter shared with an RTOS tick may have wrapped only once.
+    @param    - void
+    @return   - 1 if COUNTFLAG was set, else 0
+**/
+uint32_t pal_systick_wrapped(void)
+{
+    return ((((systick_t *)SYSTICK_BASE)->CTRL & SYSTICK_CTRL_COUNTFLAG_Msk) != 0) ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_SYSTICK_H_
+#define _PAL_SYSTICK_H_
+
+#include <stdint.h>
+
+/* SysTick is part of the System Control Space of every Armv7-M/Armv8-M core. It is
+   only accessible from privileged code, unprivileged accesses fault */
+#define SYSTICK_BASE                     0xE000E010UL
+
+/* SysTick CTRL Register Definitions */
+#define SYSTICK_CTRL_ENABLE_Pos          0
+#define SYSTICK_CTRL_ENABLE_Msk          (0x1UL << SYSTICK_CTRL_ENABLE_Pos)
+#define SYSTICK_CTRL_TICKINT_Pos         1
+#define SYSTICK_CTRL_TICKINT_Msk         (0x1UL << SYSTICK_CTRL_TICKINT_Pos)
+#define SYSTICK_CTRL_CLKSOURCE_Pos       2
+#define SYSTICK_CTRL_CLKSOURCE_Msk       (0x1UL << SYSTICK_CTRL_CLKSOURCE_Pos)
+#define SYSTICK_CTRL_COUNTFLAG_Pos       16
+#define SYSTICK_CTRL_COUNTFLAG_Msk       (0x1UL << SYSTICK_CTRL_COUNTFLAG_Pos)
+
+/* SysTick is a 24-bit down counter */
+#define SYSTICK_COUNTER_MAX              0x00FFFFFFUL
+
+/* typedef's */
+typedef struct {
+    volatile uint32_t CTRL;              /* Offset: 0x000 (R/W) SysTick Control and Status */
+    volatile uint32_t LOAD;              /* Offset: 0x004 (R/W) SysTick Reload Value */
+    volatile uint32_t VAL;               /* Offset: 0x008 (R/W) SysTick Current Value */
+    volatile uint32_t CALIB;             /* Offset: 0x00C (R/ ) SysTick Calibration */
+} systick_t;
+
+/* function prototypes */
+void pal_systick_init(void);
+uint32_t pal_systick_get_count(void);
+uint32_t pal_systick_elapsed(uint32_t start, uint32_t end);
+void pal_systick_restart(void);
+uint32_t pal_systick_wrapped(void);
+
+#endif /* _PAL_SYSTICK_H_ */
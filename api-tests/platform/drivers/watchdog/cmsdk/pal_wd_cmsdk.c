@@ -79,3 +79,32 @@ int pal_wd_cmsdk_is_enabled(addr_t base_addr)
     (((wd_timer_t *)base_addr)->CTRL & Watchdog_CTRL_RESEN_Msk ? 1 : 0) : 0);
 }
 
+/**
+    @brief           - Returns the time elapsed since the watchdog was last enabled.
+                       The counter reloads once when it first reaches zero, which is
+                       reflected in the raw interrupt status.
+    @param           - base_addr       : Base address of the watchdog module
+                     - timer_tick_us   : Number of ticks per micro second
+                     - elapsed_us      : Elapsed time in micro seconds, 0 if disabled
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_cmsdk_elapsed(addr_t base_addr, uint32_t timer_tick_us, uint32_t *elapsed_us)
+{
+    wd_timer_t *wd = (wd_timer_t *)base_addr;
+    uint32_t   ticks;
+
+    if (!pal_wd_cmsdk_is_enabled(base_addr) || (timer_tick_us == 0))
+    {
+        *elapsed_us = 0;
+        return 0;
+    }
+
+    ticks = wd->LOAD - wd->VALUE;
+    if (wd->RAWINTSTAT & Watchdog_RAWINTSTAT_Msk)
+    {
+        ticks += wd->LOAD;
+    }
+    *elapsed_us = ticks / timer_tick_us;
+
+    return 0;
+}
@@ -83,5 +83,6 @@ int pal_wd_cmsdk_init(addr_t base_addr, uint32_t time_us, uint32_t timer_tick_us
 int pal_wd_cmsdk_enable(addr_t base_addr);
 int pal_wd_cmsdk_disable(addr_t base_addr);
 int pal_wd_cmsdk_is_enabled(addr_t base_addr);
+int pal_wd_cmsdk_elapsed(addr_t base_addr, uint32_t timer_tick_us, uint32_t *elapsed_us);
 
 #endif /* PAL_WD_CMSDK_H */
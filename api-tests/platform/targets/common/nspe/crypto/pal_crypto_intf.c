@@ -25,12 +25,48 @@ psa_key_id_t g_global_key_array[PAL_KEY_SLOT_COUNT];
 uint8_t g_key_count;
 
 /**
-    @brief    - This API will call the requested crypto function
+    @brief    - Records a key created by a test so that PAL_CRYPTO_FREE can destroy it.
+                Once the table is full, further keys are left for the test to destroy,
+                as the benchmark tests do with the thousands of keys they create.
+    @param    - key     : key identifier
+    @return   - void
+**/
+static void pal_crypto_track_key(psa_key_id_t key)
+{
+    if (g_key_count < PAL_KEY_SLOT_COUNT)
+    {
+        g_global_key_array[g_key_count++] = key;
+    }
+}
+
+/**
+    @brief    - Stops tracking a key, so that PAL_CRYPTO_FREE leaves it in place. Used for
+                persistent keys that are meant to outlive the test which created them.
+    @param    - key     : key identifier
+    @return   - void
+**/
+static void pal_crypto_untrack_key(psa_key_id_t key)
+{
+    int i;
+
+    for (i = 0; i < g_key_count; i++)
+    {
+        if (g_global_key_array[i] == key)
+        {
+            g_global_key_array[i] = g_global_key_array[--g_key_count];
+            g_global_key_array[g_key_count] = (psa_key_id_t)0;
+            return;
+        }
+    }
+}
+
+/**
+    @brief    - Unpacks the arguments of the requested crypto function and calls it
     @param    - type    : function code
                 valist  : variable argument list
     @return   - error status
 **/
-int32_t pal_crypto_function(int type, va_list valist)
+static int32_t pal_crypto_dispatch(int type, va_list valist)
 {
     psa_algorithm_t                           alg;
     const uint8_t                            *input, *input1;
@@ -374,7 +410,7 @@ int32_t pal_crypto_function(int type, va_list valist)
 			status = psa_copy_key(key,
 								c_attributes,
 								target_key);
-			g_global_key_array[g_key_count++] = *target_key;
+			pal_crypto_track_key(*target_key);
                         return status;
 			break;
 		case PAL_CRYPTO_INIT:
@@ -408,7 +444,7 @@ int32_t pal_crypto_function(int type, va_list valist)
 			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
 			target_key               = va_arg(valist, psa_key_id_t *);
 			status =  psa_generate_key(c_attributes, target_key);
-                        g_global_key_array[g_key_count++] = *target_key;
+                        pal_crypto_track_key(*target_key);
                         return status;
 			break;
 		case PAL_CRYPTO_GENERATE_RANDOM:
@@ -563,7 +599,7 @@ int32_t pal_crypto_function(int type, va_list valist)
 								  input,
 								  input_length,
 								  p_key);
-			g_global_key_array[g_key_count++] = *p_key;
+			pal_crypto_track_key(*p_key);
 			return status;
 			break;
 		case PAL_CRYPTO_KEY_ATTRIBUTES_INIT:
@@ -861,6 +897,11 @@ int32_t pal_crypto_function(int type, va_list valist)
 		case PAL_CRYPTO_RESET:
 			return pal_system_reset();
 			break;
+		case PAL_CRYPTO_UNTRACK_KEY:
+			key                      = va_arg(valist, psa_key_id_t);
+			pal_crypto_untrack_key(key);
+			return 0;
+			break;
 		case PAL_CRYPTO_FREE:
 			for (int i = 0; i < g_key_count; i++) {
 				psa_destroy_key(g_global_key_array[i]);
@@ -873,3 +914,24 @@ int32_t pal_crypto_function(int type, va_list valist)
 			return PAL_STATUS_UNSUPPORTED_FUNC;
     }
 }
+
+/**
+    @brief    - This API will call the requested crypto function
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+int32_t pal_crypto_function(int type, va_list valist)
+{
+#ifdef PSA_ALLOC_STATS
+    int32_t status;
+
+    /* Heap blocks allocated until the call returns are counted against it */
+    pal_alloc_call_begin(PAL_ALLOC_CRYPTO, type);
+    status = pal_crypto_dispatch(type, valist);
+    pal_alloc_call_end();
+    return status;
+#else
+    return pal_crypto_dispatch(type, valist);
+#endif
+}
@@ -106,6 +106,7 @@ enum crypto_function_code {
     PAL_CRYPTO_VERIFY_HASH,
     PAL_CRYPTO_VERIFY_MESSAGE,
     PAL_CRYPTO_RESET                            = 0xF0,
+    PAL_CRYPTO_UNTRACK_KEY                      = 0xFD,
     PAL_CRYPTO_FREE                             = 0xFE,
 };
 
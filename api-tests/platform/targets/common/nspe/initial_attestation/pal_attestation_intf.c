@@ -19,12 +19,12 @@
 #include "pal_attestation_intf.h"
 
 /**
-    @brief    - This API will call the requested attestation function
+    @brief    - Unpacks the arguments of the requested attestation function and calls it
     @param    - type    : function code
                 valist  : variable argument list
     @return   - error status
 **/
-int32_t pal_attestation_function(int type, va_list valist)
+static int32_t pal_attestation_dispatch(int type, va_list valist)
 {
     uint8_t                *challenge, *token;
     size_t                  challenge_size, *token_size, token_buffer_size;
@@ -63,3 +63,24 @@ int32_t pal_attestation_function(int type, va_list valist)
             return PAL_STATUS_UNSUPPORTED_FUNC;
     }
 }
+
+/**
+    @brief    - This API will call the requested attestation function
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+int32_t pal_attestation_function(int type, va_list valist)
+{
+#ifdef PSA_ALLOC_STATS
+    int32_t status;
+
+    /* Heap blocks allocated until the call returns are counted against it */
+    pal_alloc_call_begin(PAL_ALLOC_ATTESTATION, type);
+    status = pal_attestation_dispatch(type, valist);
+    pal_alloc_call_end();
+    return status;
+#else
+    return pal_attestation_dispatch(type, valist);
+#endif
+}
@@ -19,12 +19,13 @@
 #include "pal_internal_trusted_storage_intf.h"
 
 /**
-    @brief    - This API will call the requested internal trusted storage function
+    @brief    - Unpacks the arguments of the requested internal trusted storage function
+                and calls it
     @param    - type    : function code
                 valist  : variable argument list
     @return   - error status
 **/
-int32_t pal_its_function(int type, va_list valist)
+static int32_t pal_its_dispatch(int type, va_list valist)
 {
     psa_storage_uid_t           uid;
     uint32_t                    data_size, offset;
@@ -60,3 +61,24 @@ int32_t pal_its_function(int type, va_list valist)
         return PAL_STATUS_UNSUPPORTED_FUNC;
     }
 }
+
+/**
+    @brief    - This API will call the requested internal trusted storage function
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+int32_t pal_its_function(int type, va_list valist)
+{
+#ifdef PSA_ALLOC_STATS
+    int32_t status;
+
+    /* Heap blocks allocated until the call returns are counted against it */
+    pal_alloc_call_begin(PAL_ALLOC_ITS, type);
+    status = pal_its_dispatch(type, valist);
+    pal_alloc_call_end();
+    return status;
+#else
+    return pal_its_dispatch(type, valist);
+#endif
+}
@@ -82,6 +82,19 @@ typedef enum {
     UART_PRINT            = 0x2,
 } uart_fn_type_t;
 
+#ifdef PSA_ALLOC_STATS
+/* PSA APIs whose calls a -DPSA_ALLOC_STATS=1 build charges heap use to, numbered as the
+ * APIs of the PSA call trace
+ */
+#define PAL_ALLOC_CRYPTO        1
+#define PAL_ALLOC_ITS           2
+#define PAL_ALLOC_PS            3
+#define PAL_ALLOC_ATTESTATION   4
+
+void pal_alloc_call_begin(uint32_t api, int type);
+void pal_alloc_call_end(void);
+#endif
+
 /*
  * Redefining some of the client.h elements for compilation to go through
  * when PSA IPC APIs are not implemented.
@@ -19,12 +19,13 @@
 #include "pal_protected_storage_intf.h"
 
 /**
-    @brief    - This API will call the requested protected storage function
+    @brief    - Unpacks the arguments of the requested protected storage function
+                and calls it
     @param    - type    : function code
                 valist  : variable argument list
     @return   - error status
 **/
-int32_t pal_ps_function(int type, va_list valist)
+static int32_t pal_ps_dispatch(int type, va_list valist)
 {
     psa_storage_uid_t          uid;
     uint32_t                   data_size, size, offset;
@@ -75,3 +76,24 @@ int32_t pal_ps_function(int type, va_list valist)
 
     return PAL_STATUS_UNSUPPORTED_FUNC;
 }
+
+/**
+    @brief    - This API will call the requested protected storage function
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+int32_t pal_ps_function(int type, va_list valist)
+{
+#ifdef PSA_ALLOC_STATS
+    int32_t status;
+
+    /* Heap blocks allocated until the call returns are counted against it */
+    pal_alloc_call_begin(PAL_ALLOC_PS, type);
+    status = pal_ps_dispatch(type, valist);
+    pal_alloc_call_end();
+    return status;
+#else
+    return pal_ps_dispatch(type, valist);
+#endif
+}
@@ -16,8 +16,15 @@
 **/
 
 #include <stdint.h>
+#ifdef PSA_PLUGIN
+#include <stdio.h>
+#include <string.h>
+#endif
 
 int32_t val_entry(void);
+#ifdef PSA_PLUGIN
+int pal_psa_plugin_load(const char *path);
+#endif
 
 /**
     @brief    - PSA C main function, used for generating tgt_dev_apis_stdc test binaries.
@@ -27,7 +34,18 @@ int32_t val_entry(void);
 **/
 int main(int argc, char **argv)
 {
+#ifdef PSA_PLUGIN
+    /* -DPSA_PLUGIN=1: the PSA implementation is loaded from --psa-lib <shared object> */
+    if ((argc != 3) || (strcmp(argv[1], "--psa-lib") != 0))
+    {
+        printf("Usage: %s --psa-lib <psa_implementation.so>\n", argv[0]);
+        return 1;
+    }
+    if (pal_psa_plugin_load(argv[2]) != 0)
+        return 1;
+#else
     (void)argc;
     (void)argv;
+#endif
     return val_entry();
 }
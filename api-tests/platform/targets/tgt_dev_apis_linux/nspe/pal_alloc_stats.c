@@ -0,0 +1,305 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "pal_common.h"
+#include "pal_interfaces_ns.h"
+
+/* In a -DPSA_ALLOC_STATS=1 build the test binary defines malloc, calloc, realloc and free,
+ * which take precedence over those of the C library for the whole process, the PSA
+ * library included. They call the glibc allocator through its __libc_* entry points and
+ * charge the blocks allocated between pal_alloc_call_begin and pal_alloc_call_end, which
+ * the PAL calls around each PSA call, to the PSA function called. Those blocks are kept
+ * in a table until freed, so that their size is known when they are freed, inside a
+ * call or not, and those still live at the end of a test are reported as its leaks.
+ * Blocks allocated outside PSA calls, by the test suite itself, are not tracked.
+ */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void  __libc_free(void *ptr);
+
+/* Function codes of a PAL dispatch run up to PAL_CRYPTO_FREE */
+#define PAL_ALLOC_APIS          5
+#define PAL_ALLOC_TYPES         0x100
+
+/* Tracked blocks, an open addressing hash table of a power of two entries */
+#define PAL_ALLOC_BLOCKS        0x10000
+
+typedef struct {
+    void     *ptr;
+    uint32_t  size;
+    uint32_t  period;
+} pal_alloc_block_t;
+
+static pal_alloc_block_t g_alloc_block[PAL_ALLOC_BLOCKS];
+static uint32_t          g_alloc_block_count;
+static uint32_t          g_alloc_untracked;
+
+static pal_alloc_stats_t g_alloc_stats[PAL_ALLOC_APIS][PAL_ALLOC_TYPES];
+
+/* PSA call in progress, api 0 when there is none */
+static struct {
+    uint32_t           api;
+    pal_alloc_stats_t *stats;
+    uint32_t           live;
+    uint32_t           peak;
+    uint32_t           period;
+} g_alloc_call;
+
+/**
+    @brief    - Returns the first table entry to look up a block at
+    @param    - ptr     : block
+    @return   - entry index
+**/
+static uint32_t pal_alloc_hash(const void *ptr)
+{
+    return (uint32_t)(((uintptr_t)ptr >> 4) * 2654435761U) & (PAL_ALLOC_BLOCKS - 1);
+}
+
+/**
+    @brief    - Tracks a block allocated by a PSA call. A block that does not fit in the
+                table is counted but not tracked, and is reported as leaked.
+    @param    - ptr     : block
+                size    : requested size in bytes
+    @return   - void
+**/
+static void pal_alloc_track(void *ptr, uint32_t size)
+{
+    uint32_t i = pal_alloc_hash(ptr);
+
+    if (g_alloc_block_count >= PAL_ALLOC_BLOCKS - 1)
+    {
+        g_alloc_untracked++;
+        return;
+    }
+    while (g_alloc_block[i].ptr != NULL)
+    {
+        i = (i + 1) & (PAL_ALLOC_BLOCKS - 1);
+    }
+    g_alloc_block[i].ptr = ptr;
+    g_alloc_block[i].size = size;
+    g_alloc_block[i].period = g_alloc_call.period;
+    g_alloc_block_count++;
+}
+
+/**
+    @brief    - Stops tracking a block, moving back the entries of its probe sequence so
+                that lookups never need to step over deleted entries
+    @param    - ptr     : block
+                size    : set to the size the block was tracked with
+    @return   - 1 if the block was tracked, 0 otherwise
+**/
+static int pal_alloc_untrack(void *ptr, uint32_t *size)
+{
+    uint32_t i = pal_alloc_hash(ptr), j, home;
+
+    while (g_alloc_block[i].ptr != ptr)
+    {
+        if (g_alloc_block[i].ptr == NULL)
+        {
+            return 0;
+        }
+        i = (i + 1) & (PAL_ALLOC_BLOCKS - 1);
+    }
+    *size = g_alloc_block[i].size;
+    g_alloc_block_count--;
+
+    for (j = (i + 1) & (PAL_ALLOC_BLOCKS - 1); g_alloc_block[j].ptr != NULL;
+         j = (j + 1) & (PAL_ALLOC_BLOCKS - 1))
+    {
+        home = pal_alloc_hash(g_alloc_block[j].ptr);
+        /* Entry j may fill the hole at i unless its home lies cyclically in (i, j] */
+        if (((j - home) & (PAL_ALLOC_BLOCKS - 1)) >= ((j - i) & (PAL_ALLOC_BLOCKS - 1)))
+        {
+            g_alloc_block[i] = g_alloc_block[j];
+            i = j;
+        }
+    }
+    g_alloc_block[i].ptr = NULL;
+    return 1;
+}
+
+/**
+    @brief    - Charges a block allocated during the call in progress to the call
+    @param    - ptr     : block, NULL if the allocation failed
+                size    : requested size in bytes
+    @return   - void
+**/
+static void pal_alloc_charge(void *ptr, size_t size)
+{
+    if ((g_alloc_call.api == 0) || (ptr == NULL))
+    {
+        return;
+    }
+    g_alloc_call.stats->allocations++;
+    g_alloc_call.stats->bytes += (uint32_t)size;
+    g_alloc_call.live += (uint32_t)size;
+    if (g_alloc_call.live > g_alloc_call.peak)
+    {
+        g_alloc_call.peak = g_alloc_call.live;
+    }
+    pal_alloc_track(ptr, (uint32_t)size);
+}
+
+/**
+    @brief    - Releases a block freed inside a PSA call or not
+    @param    - ptr     : block
+    @return   - void
+**/
+static void pal_alloc_release(void *ptr)
+{
+    uint32_t size;
+
+    if ((ptr == NULL) || !pal_alloc_untrack(ptr, &size))
+    {
+        return;
+    }
+    if (g_alloc_call.api != 0)
+    {
+        /* Freeing a block of an earlier call does not take the call below its start */
+        g_alloc_call.live = (size < g_alloc_call.live) ? (g_alloc_call.live - size) : 0;
+    }
+}
+
+void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+
+    pal_alloc_charge(ptr, size);
+    return ptr;
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+    void *ptr = __libc_calloc(nmemb, size);
+
+    pal_alloc_charge(ptr, nmemb * size);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    void *new_ptr;
+
+    if (ptr == NULL)
+    {
+        return malloc(size);
+    }
+    new_ptr = __libc_realloc(ptr, size);
+    if ((new_ptr == NULL) && (size != 0))
+    {
+        /* The block was left as it was */
+        return NULL;
+    }
+    pal_alloc_release(ptr);
+    pal_alloc_charge(new_ptr, size);
+    return new_ptr;
+}
+
+void free(void *ptr)
+{
+    pal_alloc_release(ptr);
+    __libc_free(ptr);
+}
+
+/**
+    @brief    - Starts charging heap use to a PSA call
+    @param    - api     : PAL_ALLOC_CRYPTO, PAL_ALLOC_ITS, PAL_ALLOC_PS or
+                          PAL_ALLOC_ATTESTATION
+                type    : function code
+    @return   - void
+**/
+void pal_alloc_call_begin(uint32_t api, int type)
+{
+    if ((api >= PAL_ALLOC_APIS) || ((uint32_t)type >= PAL_ALLOC_TYPES))
+    {
+        return;
+    }
+    g_alloc_call.stats = &g_alloc_stats[api][type];
+    g_alloc_call.stats->calls++;
+    g_alloc_call.live = 0;
+    g_alloc_call.peak = 0;
+    g_alloc_call.api = api;
+}
+
+/**
+    @brief    - Ends the PSA call started by pal_alloc_call_begin
+    @param    - void
+    @return   - void
+**/
+void pal_alloc_call_end(void)
+{
+    if (g_alloc_call.api == 0)
+    {
+        return;
+    }
+    if (g_alloc_call.peak > g_alloc_call.stats->peak_bytes)
+    {
+        g_alloc_call.stats->peak_bytes = g_alloc_call.peak;
+    }
+    g_alloc_call.api = 0;
+}
+
+/**
+    @brief    - Returns the heap use of the calls of a PSA function since the last read,
+                and clears it
+    @param    - api     : PAL_ALLOC_CRYPTO to PAL_ALLOC_ATTESTATION
+                type    : function code
+                stats   : heap use
+    @return   - SUCCESS/FAILURE
+**/
+int pal_alloc_stats_read_ns(uint32_t api, uint32_t type, pal_alloc_stats_t *stats)
+{
+    if ((api >= PAL_ALLOC_APIS) || (type >= PAL_ALLOC_TYPES))
+    {
+        return PAL_STATUS_ERROR;
+    }
+    *stats = g_alloc_stats[api][type];
+    memset(&g_alloc_stats[api][type], 0, sizeof(g_alloc_stats[api][type]));
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Returns the blocks allocated by PSA calls since the last read and still
+                live, then starts a new period. Blocks that did not fit in the table are
+                counted, with a size of 0.
+    @param    - blocks  : live blocks
+                bytes   : live bytes
+    @return   - SUCCESS
+**/
+int pal_alloc_leaks_read_ns(uint32_t *blocks, uint32_t *bytes)
+{
+    uint32_t i;
+
+    *blocks = g_alloc_untracked;
+    *bytes = 0;
+    for (i = 0; i < PAL_ALLOC_BLOCKS; i++)
+    {
+        if ((g_alloc_block[i].ptr != NULL) && (g_alloc_block[i].period == g_alloc_call.period))
+        {
+            (*blocks)++;
+            *bytes += g_alloc_block[i].size;
+        }
+    }
+    g_alloc_untracked = 0;
+    g_alloc_call.period++;
+    return PAL_STATUS_SUCCESS;
+}
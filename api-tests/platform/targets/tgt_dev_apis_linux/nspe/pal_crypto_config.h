@@ -323,6 +323,33 @@
  * Enable ECC support for asymmetric API.
 */
 //#define ARCH_TEST_ECC_ASYMMETRIC_API_SUPPORT
+
+/**
+ * \def BENCH_RNG_TOTAL_KB
+ *
+ * Random bytes, in KB, pulled through psa_generate_random by each check of the
+ * benchmark test_c106. The host can afford far more than the 1 MB default.
+*/
+#define BENCH_RNG_TOTAL_KB (256 * 1024)
+
+/**
+ * \def LATENCY_BUDGET_<class>_US
+ *
+ * Latency budgets, in micro seconds, of the PSA calls checked with TEST_ASSERT_LATENCY
+ * in a -DLATENCY_BUDGET=WARN or FAIL build, for example an ECDSA P-256 signature in
+ * less than 20 ms. A class without a budget is not checked.
+*/
+//#define LATENCY_BUDGET_HASH_US                  1000
+//#define LATENCY_BUDGET_MAC_US                   1000
+//#define LATENCY_BUDGET_CIPHER_US                1000
+//#define LATENCY_BUDGET_AEAD_US                  1000
+//#define LATENCY_BUDGET_SIGN_US                  20000
+//#define LATENCY_BUDGET_VERIFY_US                40000
+//#define LATENCY_BUDGET_ASYMMETRIC_ENCRYPTION_US 40000
+//#define LATENCY_BUDGET_KEY_AGREEMENT_US         20000
+//#define LATENCY_BUDGET_KEY_DERIVATION_US        5000
+//#define LATENCY_BUDGET_KEY_GENERATION_US        500000
+//#define LATENCY_BUDGET_RANDOM_US                1000
 #include "pal_crypto_config_check.h"
 
 #endif /* _PAL_CRYPTO_CONFIG_H_ */
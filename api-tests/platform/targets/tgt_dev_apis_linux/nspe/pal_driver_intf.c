@@ -15,12 +15,18 @@
  * limitations under the License.
 **/
 
+/* clock_gettime is a POSIX interface, hidden by -std=c99 unless requested */
+#define _POSIX_C_SOURCE 199309L
+
 #include <inttypes.h>
 #include <limits.h>
+#include <malloc.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "pal_common.h"
 
@@ -38,6 +44,64 @@
 #define NVMEM_SIZE (1024)
 static uint8_t g_nvmem[NVMEM_SIZE];
 
+/* When the PSA_NVMEM_FILE environment variable names a file, the array is loaded from
+ * that file on first use and written back to it on every write. The results recorded
+ * by one test process are then available to the next, e.g. to a -DRERUN_FAILED=1 build.
+ */
+#define NVMEM_FILE_ENV "PSA_NVMEM_FILE"
+static int g_nvmem_loaded;
+
+/**
+    @brief    - Load the nvmem array from the PSA_NVMEM_FILE file, if there is one
+    @param    - void
+    @return   - void
+**/
+static void nvmem_file_load(void)
+{
+    const char *path;
+    FILE       *fp;
+
+    if (g_nvmem_loaded)
+        return;
+    g_nvmem_loaded = 1;
+
+    path = getenv(NVMEM_FILE_ENV);
+    if (path == NULL)
+        return;
+
+    /* A missing file is created by the first write */
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+        return;
+    if (fread(g_nvmem, 1, NVMEM_SIZE, fp) != NVMEM_SIZE)
+        memset(g_nvmem, 0, NVMEM_SIZE);
+    fclose(fp);
+}
+
+/**
+    @brief    - Write the nvmem array back to the PSA_NVMEM_FILE file, if there is one
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+static int nvmem_file_store(void)
+{
+    const char *path;
+    FILE       *fp;
+    size_t      written;
+
+    path = getenv(NVMEM_FILE_ENV);
+    if (path == NULL)
+        return PAL_STATUS_SUCCESS;
+
+    fp = fopen(path, "wb");
+    if (fp == NULL)
+        return PAL_STATUS_ERROR;
+    written = fwrite(g_nvmem, 1, NVMEM_SIZE, fp);
+    if (fclose(fp) != 0 || written != NVMEM_SIZE)
+        return PAL_STATUS_ERROR;
+    return PAL_STATUS_SUCCESS;
+}
+
 /**
     @brief    - Check that an nvmem access is within the bounds of the nvmem
     @param    - base    : Base address of nvmem (must be zero)
@@ -74,6 +138,7 @@ int pal_nvmem_read_ns(addr_t base, uint32_t offset, void *buffer, int size)
     {
         return PAL_STATUS_ERROR;
     }
+    nvmem_file_load();
     memcpy(buffer, g_nvmem + offset, size);
     return PAL_STATUS_SUCCESS;
 }
@@ -92,8 +157,9 @@ int pal_nvmem_write_ns(addr_t base, uint32_t offset, void *buffer, int size)
     {
         return PAL_STATUS_ERROR;
     }
+    nvmem_file_load();
     memcpy(g_nvmem + offset, buffer, size);
-    return PAL_STATUS_SUCCESS;
+    return nvmem_file_store();
 }
 
 /**
@@ -176,6 +242,152 @@ int pal_wd_timer_disable_ns(addr_t base_addr)
     return PAL_STATUS_SUCCESS;
 }
 
+/* The benchmark counter is CLOCK_MONOTONIC truncated to 32 bits of nanoseconds,
+ * which wraps every 4.29 seconds, far longer than any single timed operation.
+ */
+#define TIMESTAMP_TICKS_PER_US  1000
+
+/* Full CLOCK_MONOTONIC value at pal_timestamp_start_ns, to count the 32-bit wraps */
+static uint64_t g_timestamp_start_ns;
+
+/**
+    @brief           - Returns CLOCK_MONOTONIC in nanoseconds
+    @param           - void
+    @return          - clock value, 0 if it cannot be read
+**/
+static uint64_t pal_timestamp_now(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+    {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+    @brief           - Starts the free running counter used to time benchmark operations
+
+    CLOCK_MONOTONIC is always running, no init necessary.
+
+    @param           - void
+    @return          - void
+**/
+void pal_timestamp_init_ns(void)
+{
+    ;
+}
+
+/**
+    @brief           - Returns the current value of the free running counter
+    @param           - void
+    @return          - counter value in nanoseconds
+**/
+uint32_t pal_timestamp_get_ns(void)
+{
+    return (uint32_t)pal_timestamp_now();
+}
+
+/**
+    @brief           - Returns the number of ticks between two values returned by
+                       pal_timestamp_get_ns
+    @param           - start   : timestamp taken first
+                       end     : timestamp taken last
+    @return          - elapsed ticks
+**/
+uint32_t pal_timestamp_elapsed_ns(uint32_t start, uint32_t end)
+{
+    return end - start;
+}
+
+/**
+    @brief           - Returns the number of counter ticks per micro second
+    @param           - void
+    @return          - ticks per micro second
+**/
+uint32_t pal_timestamp_ticks_per_us_ns(void)
+{
+    return TIMESTAMP_TICKS_PER_US;
+}
+
+/**
+    @brief           - Returns a timestamp to time a single call from, keeping the full
+                       clock value for pal_timestamp_wrapped_ns
+    @param           - void
+    @return          - counter value in nanoseconds
+**/
+uint32_t pal_timestamp_start_ns(void)
+{
+    g_timestamp_start_ns = pal_timestamp_now();
+    return (uint32_t)g_timestamp_start_ns;
+}
+
+/**
+    @brief           - Returns whether more than one 32-bit counter period elapsed since
+                       pal_timestamp_start_ns
+    @param           - void
+    @return          - 1 if the truncated counter wrapped beyond one period, else 0
+**/
+uint32_t pal_timestamp_wrapped_ns(void)
+{
+    return ((pal_timestamp_now() - g_timestamp_start_ns) > UINT32_MAX) ? 1 : 0;
+}
+
+/**
+    @brief           - Returns the number of heap bytes in use by the implementation under
+                       test, which shares the process heap with the test suite
+
+    This needs mallinfo2, added in glibc 2.33.
+
+    @param           - bytes   : Heap bytes in use
+    @return          - SUCCESS/PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_heap_used_ns(uint32_t *bytes)
+{
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+    struct mallinfo2 info = mallinfo2();
+
+    *bytes = (uint32_t)info.uordblks;
+    return PAL_STATUS_SUCCESS;
+#else
+    (void)bytes;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+#endif
+}
+
+/* The PSA call trace of a -DPSA_CALL_TRACE=1 build is written to the file named by the
+ * PSA_CALL_TRACE_FILE environment variable, psa_call_trace.bin by default.
+ */
+#define CALL_TRACE_FILE_ENV     "PSA_CALL_TRACE_FILE"
+#define CALL_TRACE_FILE_DEFAULT "psa_call_trace.bin"
+static FILE *g_call_trace_fp;
+
+/**
+    @brief    - Appends a record to the PSA call trace. The file is created by the first
+                record and flushed after each one, so that the trace of a crashed test
+                is complete up to the crash.
+    @param    - data    : Record
+                size    : Record size in bytes
+    @return   - SUCCESS/FAILURE
+**/
+int pal_call_trace_write_ns(const void *data, uint32_t size)
+{
+    const char *path;
+
+    if (g_call_trace_fp == NULL)
+    {
+        path = getenv(CALL_TRACE_FILE_ENV);
+        g_call_trace_fp = fopen((path != NULL) ? path : CALL_TRACE_FILE_DEFAULT, "wb");
+        if (g_call_trace_fp == NULL)
+            return PAL_STATUS_ERROR;
+    }
+
+    if (fwrite(data, 1, size, g_call_trace_fp) != size || fflush(g_call_trace_fp) != 0)
+        return PAL_STATUS_ERROR;
+    return PAL_STATUS_SUCCESS;
+}
+
 /**
      @brief    - Terminates the simulation at the end of all tests completion.
 
@@ -0,0 +1,137 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* syscall() is a GNU/POSIX interface, hidden by -std=c99 unless requested */
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+#include "pal_interfaces_ns.h"
+
+/* Hardware counters of the test process, read around each test and check of a
+ * -DPERF_COUNTERS build. Only user space is counted, so that the counters can be opened
+ * with the default perf_event_paranoid setting of 2. Instruction counts are stable from
+ * one run and one machine to the next, unlike cycles and cache misses, so an
+ * -DPERF_COUNTERS=INSTRUCTIONS build opens the instruction counter alone. It is then
+ * never multiplexed with other events, and its count is exact.
+ */
+static const struct {
+    uint32_t    type;
+    uint64_t    config;
+    const char  *name;
+} g_perf_event[PAL_PERF_COUNTERS] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,  "instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,    "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,  "cache misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch misses"},
+};
+
+#ifdef PERF_COUNTERS_INSTRUCTIONS
+#define PERF_COUNTERS_OPENED    1
+#else
+#define PERF_COUNTERS_OPENED    PAL_PERF_COUNTERS
+#endif
+
+static int g_perf_fd[PAL_PERF_COUNTERS];
+static int g_perf_opened;
+
+/* Value of a counter opened with PERF_FORMAT_TOTAL_TIME_ENABLED and _RUNNING */
+typedef struct {
+    uint64_t value;
+    uint64_t time_enabled;
+    uint64_t time_running;
+} perf_read_t;
+
+/**
+    @brief    - Opens the counters on first use. A counter the host cannot provide, as
+                in most virtual machines, is reported once and left out.
+    @param    - void
+    @return   - void
+**/
+static void perf_counters_open(void)
+{
+    struct perf_event_attr attr;
+    int                    i;
+
+    g_perf_opened = 1;
+    for (i = 0; i < PAL_PERF_COUNTERS; i++)
+    {
+        g_perf_fd[i] = -1;
+        if (i >= PERF_COUNTERS_OPENED)
+            continue;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = g_perf_event[i].type;
+        attr.config         = g_perf_event[i].config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        g_perf_fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (g_perf_fd[i] < 0)
+        {
+            printf("\tperf_event_open of the %s counter failed: %s\n",
+                   g_perf_event[i].name, strerror(errno));
+        }
+    }
+}
+
+/**
+    @brief    - Reads the hardware performance counters of the test process. The values
+                only grow, callers take the difference of two reads. A counter that was
+                multiplexed with others is scaled to the time it was enabled.
+    @param    - counters : PAL_PERF_COUNTERS values, indexed by PAL_PERF_*
+                valid    : Bit i set when counters[i] was read
+    @return   - SUCCESS, or PAL_STATUS_UNSUPPORTED_FUNC if no counter could be opened
+**/
+int pal_perf_counters_read_ns(uint64_t *counters, uint32_t *valid)
+{
+    perf_read_t  sample;
+    int          i;
+
+    if (!g_perf_opened)
+        perf_counters_open();
+
+    *valid = 0;
+    for (i = 0; i < PAL_PERF_COUNTERS; i++)
+    {
+        counters[i] = 0;
+        if (g_perf_fd[i] < 0)
+            continue;
+        if (read(g_perf_fd[i], &sample, sizeof(sample)) != (ssize_t)sizeof(sample))
+            continue;
+
+        if (sample.time_running == 0)
+            continue;
+        if (sample.time_running < sample.time_enabled)
+            counters[i] = (uint64_t)((double)sample.value * sample.time_enabled /
+                                     sample.time_running);
+        else
+            counters[i] = sample.value;
+        *valid |= 1U << i;
+    }
+
+    return (*valid != 0) ? PAL_STATUS_SUCCESS : PAL_STATUS_UNSUPPORTED_FUNC;
+}
@@ -0,0 +1,604 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "pal_common.h"
+#ifdef INITIAL_ATTESTATION
+#include "psa/crypto.h"
+#endif
+
+/* In a -DPSA_NULL_BACKEND=1 build the test binary is not linked with a PSA implementation.
+ * This file defines the psa_* entry points used by the PAL, listed in pal_psa_plugin_api.h,
+ * as stubs that do no work: every call returns PSA_SUCCESS, outputs are left unwritten and
+ * output lengths are canned. A run against it times the framework alone, the VAL and PAL
+ * dispatch of each call, and its -DFRAMEWORK_COST report gives the cost to subtract from
+ * the measurements taken against a real implementation. The tests checking outputs fail.
+ *
+ * Canned values:
+ *  - output lengths are the size of the output buffer, except for the multi-part update
+ *    calls, which return as many bytes as they were given, up to the buffer size
+ *  - keys get increasing identifiers, and report default attributes
+ *  - generate_random, key_derivation_output_bytes and storage reads fill nothing
+ *  - the attestation token is PAL_PSA_NULL_TOKEN_SIZE bytes long
+ */
+#define PAL_PSA_NULL_TOKEN_SIZE    0x100
+
+#if defined(CRYPTO) || defined(INITIAL_ATTESTATION)
+static psa_key_id_t g_psa_null_key_id;
+
+/**
+    @brief    - Returns the identifier of a new key
+    @param    - key     : set to the new identifier
+    @return   - PSA_SUCCESS
+**/
+static psa_status_t pal_psa_null_new_key(psa_key_id_t *key)
+{
+    *key = ++g_psa_null_key_id;
+    return PSA_SUCCESS;
+}
+
+/**
+    @brief    - Returns the length of the output of an update call
+    @param    - input_length    : bytes given to the call
+                output_size     : size of the output buffer
+                output_length   : set to the smaller of the two
+    @return   - PSA_SUCCESS
+**/
+static psa_status_t pal_psa_null_update(size_t input_length, size_t output_size,
+                                        size_t *output_length)
+{
+    *output_length = (input_length < output_size) ? input_length : output_size;
+    return PSA_SUCCESS;
+}
+
+/* Library initialization and key management */
+psa_status_t psa_crypto_init(void)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_get_key_attributes(psa_key_id_t key, psa_key_attributes_t *attributes)
+{
+    psa_key_attributes_t init = PSA_KEY_ATTRIBUTES_INIT;
+
+    *attributes = init;
+    return PSA_SUCCESS;
+}
+
+void psa_reset_key_attributes(psa_key_attributes_t *attributes)
+{
+    psa_key_attributes_t init = PSA_KEY_ATTRIBUTES_INIT;
+
+    *attributes = init;
+}
+
+psa_status_t psa_purge_key(psa_key_id_t key)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_copy_key(psa_key_id_t source_key, const psa_key_attributes_t *attributes,
+                          psa_key_id_t *target_key)
+{
+    return pal_psa_null_new_key(target_key);
+}
+
+psa_status_t psa_destroy_key(psa_key_id_t key)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_import_key(const psa_key_attributes_t *attributes, const uint8_t *data,
+                            size_t data_length, psa_key_id_t *key)
+{
+    return pal_psa_null_new_key(key);
+}
+
+psa_status_t psa_export_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                            size_t *data_length)
+{
+    *data_length = data_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_export_public_key(psa_key_id_t key, uint8_t *data, size_t data_size,
+                                   size_t *data_length)
+{
+    *data_length = data_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_generate_key(const psa_key_attributes_t *attributes, psa_key_id_t *key)
+{
+    return pal_psa_null_new_key(key);
+}
+
+psa_status_t psa_generate_random(uint8_t *output, size_t output_size)
+{
+    return PSA_SUCCESS;
+}
+
+/* Message digests */
+psa_status_t psa_hash_compute(psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                              uint8_t *hash, size_t hash_size, size_t *hash_length)
+{
+    *hash_length = hash_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_compare(psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+                              const uint8_t *hash, size_t hash_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_setup(psa_hash_operation_t *operation, psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_update(psa_hash_operation_t *operation, const uint8_t *input,
+                             size_t input_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_finish(psa_hash_operation_t *operation, uint8_t *hash, size_t hash_size,
+                             size_t *hash_length)
+{
+    *hash_length = hash_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_verify(psa_hash_operation_t *operation, const uint8_t *hash,
+                             size_t hash_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_abort(psa_hash_operation_t *operation)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_clone(const psa_hash_operation_t *source_operation,
+                            psa_hash_operation_t *target_operation)
+{
+    return PSA_SUCCESS;
+}
+
+#ifdef CRYPTO_1_0
+psa_status_t psa_hash_suspend(psa_hash_operation_t *operation, uint8_t *hash_state,
+                              size_t hash_state_size, size_t *hash_state_length)
+{
+    *hash_state_length = hash_state_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_hash_resume(psa_hash_operation_t *operation, const uint8_t *hash_state,
+                             size_t hash_state_length)
+{
+    return PSA_SUCCESS;
+}
+#endif
+
+/* Message authentication codes */
+psa_status_t psa_mac_compute(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                             size_t input_length, uint8_t *mac, size_t mac_size,
+                             size_t *mac_length)
+{
+    *mac_length = mac_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_verify(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                            size_t input_length, const uint8_t *mac, size_t mac_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_sign_setup(psa_mac_operation_t *operation, psa_key_id_t key,
+                                psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_verify_setup(psa_mac_operation_t *operation, psa_key_id_t key,
+                                  psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_update(psa_mac_operation_t *operation, const uint8_t *input,
+                            size_t input_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_sign_finish(psa_mac_operation_t *operation, uint8_t *mac, size_t mac_size,
+                                 size_t *mac_length)
+{
+    *mac_length = mac_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_verify_finish(psa_mac_operation_t *operation, const uint8_t *mac,
+                                   size_t mac_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_mac_abort(psa_mac_operation_t *operation)
+{
+    return PSA_SUCCESS;
+}
+
+/* Symmetric ciphers */
+psa_status_t psa_cipher_encrypt(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                                size_t input_length, uint8_t *output, size_t output_size,
+                                size_t *output_length)
+{
+    *output_length = output_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_decrypt(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                                size_t input_length, uint8_t *output, size_t output_size,
+                                size_t *output_length)
+{
+    *output_length = output_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_encrypt_setup(psa_cipher_operation_t *operation, psa_key_id_t key,
+                                      psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_decrypt_setup(psa_cipher_operation_t *operation, psa_key_id_t key,
+                                      psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_generate_iv(psa_cipher_operation_t *operation, uint8_t *iv,
+                                    size_t iv_size, size_t *iv_length)
+{
+    *iv_length = iv_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_set_iv(psa_cipher_operation_t *operation, const uint8_t *iv,
+                               size_t iv_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_update(psa_cipher_operation_t *operation, const uint8_t *input,
+                               size_t input_length, uint8_t *output, size_t output_size,
+                               size_t *output_length)
+{
+    return pal_psa_null_update(input_length, output_size, output_length);
+}
+
+psa_status_t psa_cipher_finish(psa_cipher_operation_t *operation, uint8_t *output,
+                               size_t output_size, size_t *output_length)
+{
+    *output_length = 0;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_cipher_abort(psa_cipher_operation_t *operation)
+{
+    return PSA_SUCCESS;
+}
+
+/* Authenticated encryption with associated data */
+psa_status_t psa_aead_encrypt(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *nonce,
+                              size_t nonce_length, const uint8_t *additional_data,
+                              size_t additional_data_length, const uint8_t *plaintext,
+                              size_t plaintext_length, uint8_t *ciphertext,
+                              size_t ciphertext_size, size_t *ciphertext_length)
+{
+    *ciphertext_length = ciphertext_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_decrypt(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *nonce,
+                              size_t nonce_length, const uint8_t *additional_data,
+                              size_t additional_data_length, const uint8_t *ciphertext,
+                              size_t ciphertext_length, uint8_t *plaintext,
+                              size_t plaintext_size, size_t *plaintext_length)
+{
+    *plaintext_length = plaintext_size;
+    return PSA_SUCCESS;
+}
+
+#if MISSING_CRYPTO_1_0 == 0
+psa_status_t psa_aead_encrypt_setup(psa_aead_operation_t *operation, psa_key_id_t key,
+                                    psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_decrypt_setup(psa_aead_operation_t *operation, psa_key_id_t key,
+                                    psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_generate_nonce(psa_aead_operation_t *operation, uint8_t *nonce,
+                                     size_t nonce_size, size_t *nonce_length)
+{
+    *nonce_length = nonce_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_set_nonce(psa_aead_operation_t *operation, const uint8_t *nonce,
+                                size_t nonce_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_set_lengths(psa_aead_operation_t *operation, size_t ad_length,
+                                  size_t plaintext_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_update_ad(psa_aead_operation_t *operation, const uint8_t *input,
+                                size_t input_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_update(psa_aead_operation_t *operation, const uint8_t *input,
+                             size_t input_length, uint8_t *output, size_t output_size,
+                             size_t *output_length)
+{
+    return pal_psa_null_update(input_length, output_size, output_length);
+}
+
+psa_status_t psa_aead_finish(psa_aead_operation_t *operation, uint8_t *ciphertext,
+                             size_t ciphertext_size, size_t *ciphertext_length, uint8_t *tag,
+                             size_t tag_size, size_t *tag_length)
+{
+    *ciphertext_length = 0;
+    *tag_length = tag_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_verify(psa_aead_operation_t *operation, uint8_t *plaintext,
+                             size_t plaintext_size, size_t *plaintext_length,
+                             const uint8_t *tag, size_t tag_length)
+{
+    *plaintext_length = 0;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_aead_abort(psa_aead_operation_t *operation)
+{
+    return PSA_SUCCESS;
+}
+#endif
+
+/* Asymmetric signature and encryption */
+psa_status_t psa_sign_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                              size_t input_length, uint8_t *signature, size_t signature_size,
+                              size_t *signature_length)
+{
+    *signature_length = signature_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_verify_message(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input,
+                                size_t input_length, const uint8_t *signature,
+                                size_t signature_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_sign_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                           size_t hash_length, uint8_t *signature, size_t signature_size,
+                           size_t *signature_length)
+{
+    *signature_length = signature_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash,
+                             size_t hash_length, const uint8_t *signature,
+                             size_t signature_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_asymmetric_encrypt(psa_key_id_t key, psa_algorithm_t alg,
+                                    const uint8_t *input, size_t input_length,
+                                    const uint8_t *salt, size_t salt_length, uint8_t *output,
+                                    size_t output_size, size_t *output_length)
+{
+    *output_length = output_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_asymmetric_decrypt(psa_key_id_t key, psa_algorithm_t alg,
+                                    const uint8_t *input, size_t input_length,
+                                    const uint8_t *salt, size_t salt_length, uint8_t *output,
+                                    size_t output_size, size_t *output_length)
+{
+    *output_length = output_size;
+    return PSA_SUCCESS;
+}
+
+/* Key derivation and key agreement */
+psa_status_t psa_key_derivation_setup(psa_key_derivation_operation_t *operation,
+                                      psa_algorithm_t alg)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_get_capacity(const psa_key_derivation_operation_t *operation,
+                                             size_t *capacity)
+{
+    *capacity = PSA_KEY_DERIVATION_UNLIMITED_CAPACITY;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_set_capacity(psa_key_derivation_operation_t *operation,
+                                             size_t capacity)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_input_bytes(psa_key_derivation_operation_t *operation,
+                                            psa_key_derivation_step_t step,
+                                            const uint8_t *data, size_t data_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_input_key(psa_key_derivation_operation_t *operation,
+                                          psa_key_derivation_step_t step, psa_key_id_t key)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_key_agreement(psa_key_derivation_operation_t *operation,
+                                              psa_key_derivation_step_t step,
+                                              psa_key_id_t private_key,
+                                              const uint8_t *peer_key, size_t peer_key_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_output_bytes(psa_key_derivation_operation_t *operation,
+                                             uint8_t *output, size_t output_length)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_key_derivation_output_key(const psa_key_attributes_t *attributes,
+                                           psa_key_derivation_operation_t *operation,
+                                           psa_key_id_t *key)
+{
+    return pal_psa_null_new_key(key);
+}
+
+psa_status_t psa_key_derivation_abort(psa_key_derivation_operation_t *operation)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_raw_key_agreement(psa_algorithm_t alg, psa_key_id_t private_key,
+                                   const uint8_t *peer_key, size_t peer_key_length,
+                                   uint8_t *output, size_t output_size, size_t *output_length)
+{
+    *output_length = output_size;
+    return PSA_SUCCESS;
+}
+#endif /* CRYPTO || INITIAL_ATTESTATION */
+
+#if defined(INTERNAL_TRUSTED_STORAGE) || defined(STORAGE)
+psa_status_t psa_its_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+                         psa_storage_create_flags_t create_flags)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_its_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size,
+                         void *p_data, size_t *p_data_length)
+{
+    *p_data_length = data_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_its_get_info(psa_storage_uid_t uid, struct psa_storage_info_t *p_info)
+{
+    memset(p_info, 0, sizeof(*p_info));
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_its_remove(psa_storage_uid_t uid)
+{
+    return PSA_SUCCESS;
+}
+#endif
+
+#if defined(PROTECTED_STORAGE) || defined(STORAGE)
+psa_status_t psa_ps_set(psa_storage_uid_t uid, size_t data_length, const void *p_data,
+                        psa_storage_create_flags_t create_flags)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_get(psa_storage_uid_t uid, size_t data_offset, size_t data_size,
+                        void *p_data, size_t *p_data_length)
+{
+    *p_data_length = data_size;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_get_info(psa_storage_uid_t uid, struct psa_storage_info_t *p_info)
+{
+    memset(p_info, 0, sizeof(*p_info));
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_remove(psa_storage_uid_t uid)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_create(psa_storage_uid_t uid, size_t capacity,
+                           psa_storage_create_flags_t create_flags)
+{
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_ps_set_extended(psa_storage_uid_t uid, size_t data_offset, size_t data_length,
+                                 const void *p_data)
+{
+    return PSA_SUCCESS;
+}
+
+uint32_t psa_ps_get_support(void)
+{
+    return 0;
+}
+#endif
+
+#ifdef INITIAL_ATTESTATION
+psa_status_t psa_initial_attest_get_token(const uint8_t *auth_challenge, size_t challenge_size,
+                                          uint8_t *token_buf, size_t token_buf_size,
+                                          size_t *token_size)
+{
+    *token_size = (token_buf_size < PAL_PSA_NULL_TOKEN_SIZE) ? token_buf_size :
+                  PAL_PSA_NULL_TOKEN_SIZE;
+    return PSA_SUCCESS;
+}
+
+psa_status_t psa_initial_attest_get_token_size(size_t challenge_size, size_t *token_size)
+{
+    *token_size = PAL_PSA_NULL_TOKEN_SIZE;
+    return PSA_SUCCESS;
+}
+#endif
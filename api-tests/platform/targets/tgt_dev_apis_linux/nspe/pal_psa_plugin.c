@@ -0,0 +1,136 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* dlopen and RTLD_DEEPBIND are GNU/POSIX interfaces, hidden by -std=c99 unless requested */
+#define _GNU_SOURCE
+
+#include <dlfcn.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pal_common.h"
+#ifdef INITIAL_ATTESTATION
+#include "psa/crypto.h"
+#endif
+
+/* In a -DPSA_PLUGIN=1 build the test binary is not linked with a PSA implementation.
+ * This file defines the psa_* entry points used by the PAL instead, each of which calls
+ * through a function table resolved from the shared object given to main() with
+ * --psa-lib. One build of the suite can then run against any number of implementations
+ * built with the same PSA headers. The entry points are listed in pal_psa_plugin_api.h.
+ */
+
+/* Function pointer type of each entry point */
+#define PAL_PSA_PLUGIN_API(ret, name, params, args, fail) \
+    typedef ret (*name##_fn_t) params;
+#define PAL_PSA_PLUGIN_VOID_API(name, params, args) \
+    typedef void (*name##_fn_t) params;
+#include "pal_psa_plugin_api.h"
+#undef PAL_PSA_PLUGIN_API
+#undef PAL_PSA_PLUGIN_VOID_API
+
+/* Entry points resolved from the plugin, NULL when it does not export one */
+typedef struct {
+#define PAL_PSA_PLUGIN_API(ret, name, params, args, fail) \
+    name##_fn_t name;
+#define PAL_PSA_PLUGIN_VOID_API(name, params, args) \
+    name##_fn_t name;
+#include "pal_psa_plugin_api.h"
+#undef PAL_PSA_PLUGIN_API
+#undef PAL_PSA_PLUGIN_VOID_API
+} pal_psa_plugin_table_t;
+
+static pal_psa_plugin_table_t g_psa_plugin;
+static void                  *g_psa_plugin_handle;
+
+/**
+    @brief    - Loads a PSA implementation from a shared object and resolves its entry
+                points. An entry point the library does not export is reported and
+                returns PSA_ERROR_NOT_SUPPORTED when called.
+    @param    - path    : path of the shared object
+    @return   - SUCCESS/FAILURE
+**/
+int pal_psa_plugin_load(const char *path)
+{
+    int resolved = 0, total = 0;
+
+    if (g_psa_plugin_handle != NULL)
+    {
+        printf("PSA plugin already loaded, ignoring %s\n", path);
+        return PAL_STATUS_ERROR;
+    }
+
+    /* RTLD_DEEPBIND keeps the library's calls to its own psa_* functions inside the
+     * library, even if the test binary exports the wrappers below.
+     */
+    g_psa_plugin_handle = dlopen(path, RTLD_NOW | RTLD_LOCAL | RTLD_DEEPBIND);
+    if (g_psa_plugin_handle == NULL)
+    {
+        printf("Failed to load PSA plugin: %s\n", dlerror());
+        return PAL_STATUS_ERROR;
+    }
+
+    /* Converting the void * of dlsym to a function pointer through its address is the
+     * form POSIX recommends for ISO C compilers.
+     */
+#define PAL_PSA_PLUGIN_RESOLVE(name)                                           \
+    do {                                                                       \
+        *(void **)(&g_psa_plugin.name) = dlsym(g_psa_plugin_handle, #name);   \
+        total++;                                                               \
+        if (g_psa_plugin.name != NULL)                                         \
+            resolved++;                                                        \
+        else                                                                   \
+            printf("PSA plugin does not export %s\n", #name);                  \
+    } while (0);
+#define PAL_PSA_PLUGIN_API(ret, name, params, args, fail) \
+    PAL_PSA_PLUGIN_RESOLVE(name)
+#define PAL_PSA_PLUGIN_VOID_API(name, params, args) \
+    PAL_PSA_PLUGIN_RESOLVE(name)
+#include "pal_psa_plugin_api.h"
+#undef PAL_PSA_PLUGIN_API
+#undef PAL_PSA_PLUGIN_VOID_API
+#undef PAL_PSA_PLUGIN_RESOLVE
+
+    printf("PSA plugin %s: %d of %d entry points resolved\n", path, resolved, total);
+    if (resolved == 0)
+    {
+        dlclose(g_psa_plugin_handle);
+        g_psa_plugin_handle = NULL;
+        return PAL_STATUS_ERROR;
+    }
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/* The psa_* entry points called by the PAL */
+#define PAL_PSA_PLUGIN_API(ret, name, params, args, fail) \
+    ret name params                                      \
+    {                                                    \
+        if (g_psa_plugin.name == NULL)                   \
+            return fail;                                 \
+        return g_psa_plugin.name args;                   \
+    }
+#define PAL_PSA_PLUGIN_VOID_API(name, params, args)      \
+    void name params                                     \
+    {                                                    \
+        if (g_psa_plugin.name != NULL)                   \
+            g_psa_plugin.name args;                      \
+    }
+#include "pal_psa_plugin_api.h"
+#undef PAL_PSA_PLUGIN_API
+#undef PAL_PSA_PLUGIN_VOID_API
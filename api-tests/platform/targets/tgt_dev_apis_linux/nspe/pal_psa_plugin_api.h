@@ -0,0 +1,346 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* PSA entry points resolved from the plugin library of a -DPSA_PLUGIN=1 build.
+ *
+ * This file is included several times by pal_psa_plugin.c, with the two macros below
+ * defined to generate the function table, the symbol lookup and the psa_* wrappers:
+ *
+ *     PAL_PSA_PLUGIN_API(ret, name, params, args, fail)
+ *     PAL_PSA_PLUGIN_VOID_API(name, params, args)
+ *
+ * fail is returned by the wrapper when the plugin does not export the entry point.
+ * Only functions with external linkage are listed; the key attribute accessors and
+ * the operation initializers are inline in the PSA headers used for the build.
+ */
+
+#if defined(CRYPTO) || defined(INITIAL_ATTESTATION)
+/* Library initialization and key management */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_crypto_init, (void), (), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_get_key_attributes,
+    (psa_key_id_t key, psa_key_attributes_t *attributes),
+    (key, attributes), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_VOID_API(psa_reset_key_attributes,
+    (psa_key_attributes_t *attributes),
+    (attributes))
+PAL_PSA_PLUGIN_API(psa_status_t, psa_purge_key,
+    (psa_key_id_t key),
+    (key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_copy_key,
+    (psa_key_id_t source_key, const psa_key_attributes_t *attributes,
+     psa_key_id_t *target_key),
+    (source_key, attributes, target_key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_destroy_key,
+    (psa_key_id_t key),
+    (key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_import_key,
+    (const psa_key_attributes_t *attributes, const uint8_t *data, size_t data_length,
+     psa_key_id_t *key),
+    (attributes, data, data_length, key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_export_key,
+    (psa_key_id_t key, uint8_t *data, size_t data_size, size_t *data_length),
+    (key, data, data_size, data_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_export_public_key,
+    (psa_key_id_t key, uint8_t *data, size_t data_size, size_t *data_length),
+    (key, data, data_size, data_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_generate_key,
+    (const psa_key_attributes_t *attributes, psa_key_id_t *key),
+    (attributes, key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_generate_random,
+    (uint8_t *output, size_t output_size),
+    (output, output_size), PSA_ERROR_NOT_SUPPORTED)
+
+/* Message digests */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_compute,
+    (psa_algorithm_t alg, const uint8_t *input, size_t input_length, uint8_t *hash,
+     size_t hash_size, size_t *hash_length),
+    (alg, input, input_length, hash, hash_size, hash_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_compare,
+    (psa_algorithm_t alg, const uint8_t *input, size_t input_length, const uint8_t *hash,
+     size_t hash_length),
+    (alg, input, input_length, hash, hash_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_setup,
+    (psa_hash_operation_t *operation, psa_algorithm_t alg),
+    (operation, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_update,
+    (psa_hash_operation_t *operation, const uint8_t *input, size_t input_length),
+    (operation, input, input_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_finish,
+    (psa_hash_operation_t *operation, uint8_t *hash, size_t hash_size, size_t *hash_length),
+    (operation, hash, hash_size, hash_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_verify,
+    (psa_hash_operation_t *operation, const uint8_t *hash, size_t hash_length),
+    (operation, hash, hash_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_abort,
+    (psa_hash_operation_t *operation),
+    (operation), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_clone,
+    (const psa_hash_operation_t *source_operation, psa_hash_operation_t *target_operation),
+    (source_operation, target_operation), PSA_ERROR_NOT_SUPPORTED)
+#ifdef CRYPTO_1_0
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_suspend,
+    (psa_hash_operation_t *operation, uint8_t *hash_state, size_t hash_state_size,
+     size_t *hash_state_length),
+    (operation, hash_state, hash_state_size, hash_state_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_hash_resume,
+    (psa_hash_operation_t *operation, const uint8_t *hash_state, size_t hash_state_length),
+    (operation, hash_state, hash_state_length), PSA_ERROR_NOT_SUPPORTED)
+#endif
+
+/* Message authentication codes */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_compute,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     uint8_t *mac, size_t mac_size, size_t *mac_length),
+    (key, alg, input, input_length, mac, mac_size, mac_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_verify,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     const uint8_t *mac, size_t mac_length),
+    (key, alg, input, input_length, mac, mac_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_sign_setup,
+    (psa_mac_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_verify_setup,
+    (psa_mac_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_update,
+    (psa_mac_operation_t *operation, const uint8_t *input, size_t input_length),
+    (operation, input, input_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_sign_finish,
+    (psa_mac_operation_t *operation, uint8_t *mac, size_t mac_size, size_t *mac_length),
+    (operation, mac, mac_size, mac_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_verify_finish,
+    (psa_mac_operation_t *operation, const uint8_t *mac, size_t mac_length),
+    (operation, mac, mac_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_mac_abort,
+    (psa_mac_operation_t *operation),
+    (operation), PSA_ERROR_NOT_SUPPORTED)
+
+/* Symmetric ciphers */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_encrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     uint8_t *output, size_t output_size, size_t *output_length),
+    (key, alg, input, input_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_decrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     uint8_t *output, size_t output_size, size_t *output_length),
+    (key, alg, input, input_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_encrypt_setup,
+    (psa_cipher_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_decrypt_setup,
+    (psa_cipher_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_generate_iv,
+    (psa_cipher_operation_t *operation, uint8_t *iv, size_t iv_size, size_t *iv_length),
+    (operation, iv, iv_size, iv_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_set_iv,
+    (psa_cipher_operation_t *operation, const uint8_t *iv, size_t iv_length),
+    (operation, iv, iv_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_update,
+    (psa_cipher_operation_t *operation, const uint8_t *input, size_t input_length,
+     uint8_t *output, size_t output_size, size_t *output_length),
+    (operation, input, input_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_finish,
+    (psa_cipher_operation_t *operation, uint8_t *output, size_t output_size,
+     size_t *output_length),
+    (operation, output, output_size, output_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_cipher_abort,
+    (psa_cipher_operation_t *operation),
+    (operation), PSA_ERROR_NOT_SUPPORTED)
+
+/* Authenticated encryption with associated data */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_encrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *nonce, size_t nonce_length,
+     const uint8_t *additional_data, size_t additional_data_length,
+     const uint8_t *plaintext, size_t plaintext_length, uint8_t *ciphertext,
+     size_t ciphertext_size, size_t *ciphertext_length),
+    (key, alg, nonce, nonce_length, additional_data, additional_data_length, plaintext,
+     plaintext_length, ciphertext, ciphertext_size, ciphertext_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_decrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *nonce, size_t nonce_length,
+     const uint8_t *additional_data, size_t additional_data_length,
+     const uint8_t *ciphertext, size_t ciphertext_length, uint8_t *plaintext,
+     size_t plaintext_size, size_t *plaintext_length),
+    (key, alg, nonce, nonce_length, additional_data, additional_data_length, ciphertext,
+     ciphertext_length, plaintext, plaintext_size, plaintext_length),
+    PSA_ERROR_NOT_SUPPORTED)
+#if MISSING_CRYPTO_1_0 == 0
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_encrypt_setup,
+    (psa_aead_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_decrypt_setup,
+    (psa_aead_operation_t *operation, psa_key_id_t key, psa_algorithm_t alg),
+    (operation, key, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_generate_nonce,
+    (psa_aead_operation_t *operation, uint8_t *nonce, size_t nonce_size,
+     size_t *nonce_length),
+    (operation, nonce, nonce_size, nonce_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_set_nonce,
+    (psa_aead_operation_t *operation, const uint8_t *nonce, size_t nonce_length),
+    (operation, nonce, nonce_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_set_lengths,
+    (psa_aead_operation_t *operation, size_t ad_length, size_t plaintext_length),
+    (operation, ad_length, plaintext_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_update_ad,
+    (psa_aead_operation_t *operation, const uint8_t *input, size_t input_length),
+    (operation, input, input_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_update,
+    (psa_aead_operation_t *operation, const uint8_t *input, size_t input_length,
+     uint8_t *output, size_t output_size, size_t *output_length),
+    (operation, input, input_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_finish,
+    (psa_aead_operation_t *operation, uint8_t *ciphertext, size_t ciphertext_size,
+     size_t *ciphertext_length, uint8_t *tag, size_t tag_size, size_t *tag_length),
+    (operation, ciphertext, ciphertext_size, ciphertext_length, tag, tag_size, tag_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_verify,
+    (psa_aead_operation_t *operation, uint8_t *plaintext, size_t plaintext_size,
+     size_t *plaintext_length, const uint8_t *tag, size_t tag_length),
+    (operation, plaintext, plaintext_size, plaintext_length, tag, tag_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_aead_abort,
+    (psa_aead_operation_t *operation),
+    (operation), PSA_ERROR_NOT_SUPPORTED)
+#endif
+
+/* Asymmetric signature and encryption */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_sign_message,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     uint8_t *signature, size_t signature_size, size_t *signature_length),
+    (key, alg, input, input_length, signature, signature_size, signature_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_verify_message,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     const uint8_t *signature, size_t signature_length),
+    (key, alg, input, input_length, signature, signature_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_sign_hash,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash, size_t hash_length,
+     uint8_t *signature, size_t signature_size, size_t *signature_length),
+    (key, alg, hash, hash_length, signature, signature_size, signature_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_verify_hash,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *hash, size_t hash_length,
+     const uint8_t *signature, size_t signature_length),
+    (key, alg, hash, hash_length, signature, signature_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_asymmetric_encrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     const uint8_t *salt, size_t salt_length, uint8_t *output, size_t output_size,
+     size_t *output_length),
+    (key, alg, input, input_length, salt, salt_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_asymmetric_decrypt,
+    (psa_key_id_t key, psa_algorithm_t alg, const uint8_t *input, size_t input_length,
+     const uint8_t *salt, size_t salt_length, uint8_t *output, size_t output_size,
+     size_t *output_length),
+    (key, alg, input, input_length, salt, salt_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+
+/* Key derivation and key agreement */
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_setup,
+    (psa_key_derivation_operation_t *operation, psa_algorithm_t alg),
+    (operation, alg), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_get_capacity,
+    (const psa_key_derivation_operation_t *operation, size_t *capacity),
+    (operation, capacity), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_set_capacity,
+    (psa_key_derivation_operation_t *operation, size_t capacity),
+    (operation, capacity), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_input_bytes,
+    (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,
+     const uint8_t *data, size_t data_length),
+    (operation, step, data, data_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_input_key,
+    (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,
+     psa_key_id_t key),
+    (operation, step, key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_key_agreement,
+    (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,
+     psa_key_id_t private_key, const uint8_t *peer_key, size_t peer_key_length),
+    (operation, step, private_key, peer_key, peer_key_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_output_bytes,
+    (psa_key_derivation_operation_t *operation, uint8_t *output, size_t output_length),
+    (operation, output, output_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_output_key,
+    (const psa_key_attributes_t *attributes, psa_key_derivation_operation_t *operation,
+     psa_key_id_t *key),
+    (attributes, operation, key), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_key_derivation_abort,
+    (psa_key_derivation_operation_t *operation),
+    (operation), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_raw_key_agreement,
+    (psa_algorithm_t alg, psa_key_id_t private_key, const uint8_t *peer_key,
+     size_t peer_key_length, uint8_t *output, size_t output_size, size_t *output_length),
+    (alg, private_key, peer_key, peer_key_length, output, output_size, output_length),
+    PSA_ERROR_NOT_SUPPORTED)
+#endif /* CRYPTO || INITIAL_ATTESTATION */
+
+#if defined(INTERNAL_TRUSTED_STORAGE) || defined(STORAGE)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_its_set,
+    (psa_storage_uid_t uid, size_t data_length, const void *p_data,
+     psa_storage_create_flags_t create_flags),
+    (uid, data_length, p_data, create_flags), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_its_get,
+    (psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+     size_t *p_data_length),
+    (uid, data_offset, data_size, p_data, p_data_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_its_get_info,
+    (psa_storage_uid_t uid, struct psa_storage_info_t *p_info),
+    (uid, p_info), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_its_remove,
+    (psa_storage_uid_t uid),
+    (uid), PSA_ERROR_NOT_SUPPORTED)
+#endif
+
+#if defined(PROTECTED_STORAGE) || defined(STORAGE)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_set,
+    (psa_storage_uid_t uid, size_t data_length, const void *p_data,
+     psa_storage_create_flags_t create_flags),
+    (uid, data_length, p_data, create_flags), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_get,
+    (psa_storage_uid_t uid, size_t data_offset, size_t data_size, void *p_data,
+     size_t *p_data_length),
+    (uid, data_offset, data_size, p_data, p_data_length), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_get_info,
+    (psa_storage_uid_t uid, struct psa_storage_info_t *p_info),
+    (uid, p_info), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_remove,
+    (psa_storage_uid_t uid),
+    (uid), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_create,
+    (psa_storage_uid_t uid, size_t capacity, psa_storage_create_flags_t create_flags),
+    (uid, capacity, create_flags), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_ps_set_extended,
+    (psa_storage_uid_t uid, size_t data_offset, size_t data_length, const void *p_data),
+    (uid, data_offset, data_length, p_data), PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(uint32_t, psa_ps_get_support, (void), (), 0)
+#endif
+
+#ifdef INITIAL_ATTESTATION
+PAL_PSA_PLUGIN_API(psa_status_t, psa_initial_attest_get_token,
+    (const uint8_t *auth_challenge, size_t challenge_size, uint8_t *token_buf,
+     size_t token_buf_size, size_t *token_size),
+    (auth_challenge, challenge_size, token_buf, token_buf_size, token_size),
+    PSA_ERROR_NOT_SUPPORTED)
+PAL_PSA_PLUGIN_API(psa_status_t, psa_initial_attest_get_token_size,
+    (size_t challenge_size, size_t *token_size),
+    (challenge_size, token_size), PSA_ERROR_NOT_SUPPORTED)
+#endif
@@ -43,6 +43,26 @@ if(${SUITE} STREQUAL "CRYPTO")
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
 endif()
+if(${PSA_PLUGIN} EQUAL 1)
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_psa_plugin.c
+	)
+endif()
+if(${PSA_NULL_BACKEND} EQUAL 1)
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_psa_null.c
+	)
+endif()
+if(${PSA_ALLOC_STATS} EQUAL 1)
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_alloc_stats.c
+	)
+endif()
+if(NOT ${PERF_COUNTERS} STREQUAL "OFF")
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_perf_counters.c
+	)
+endif()
 if(${SUITE} STREQUAL "PROTECTED_STORAGE")
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/protected_storage/pal_protected_storage_intf.c
@@ -19,6 +19,10 @@
 #include "pal_uart.h"
 #include "pal_nvmem.h"
 #include "pal_wd_cmsdk.h"
+#include "pal_systick.h"
+
+/* SysTick benchmark counter rate, 25 MHz system clock, also used by QEMU mps2-an521 */
+#define TIMESTAMP_TICKS_PER_US  25
 
 /**
     @brief    - This function initializes the UART
@@ -76,6 +80,109 @@ int pal_wd_timer_disable_ns(addr_t base_addr)
     return (pal_wd_cmsdk_disable(base_addr));
 }
 
+/**
+    @brief           - Returns the time elapsed since the watchdog was last enabled
+    @param           - base_addr       : Base address of the watchdog module
+                     - timer_tick_us   : Number of ticks per micro second
+                     - elapsed_us      : Elapsed time in micro seconds
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_elapsed_ns(addr_t base_addr, uint32_t timer_tick_us, uint32_t *elapsed_us)
+{
+    return pal_wd_cmsdk_elapsed(base_addr, timer_tick_us, elapsed_us);
+}
+
+/**
+    @brief           - Starts the free running counter used to time benchmark operations
+    @param           - void
+    @return          - void
+**/
+void pal_timestamp_init_ns(void)
+{
+    pal_systick_init();
+}
+
+/**
+    @brief           - Returns the current value of the free running counter
+    @param           - void
+    @return          - counter value in ticks
+**/
+uint32_t pal_timestamp_get_ns(void)
+{
+    return pal_systick_get_count();
+}
+
+/**
+    @brief           - Returns the number of ticks between two values returned by
+                       pal_timestamp_get_ns
+    @param           - start   : timestamp taken first
+                       end     : timestamp taken last
+    @return          - elapsed ticks
+**/
+uint32_t pal_timestamp_elapsed_ns(uint32_t start, uint32_t end)
+{
+    return pal_systick_elapsed(start, end);
+}
+
+/**
+    @brief           - Returns the number of counter ticks per micro second
+    @param           - void
+    @return          - ticks per micro second
+**/
+uint32_t pal_timestamp_ticks_per_us_ns(void)
+{
+    return TIMESTAMP_TICKS_PER_US;
+}
+
+/**
+    @brief           - Restarts SysTick, when the test suite owns it, and clears its
+                       COUNTFLAG before timing a single call
+    @param           - void
+    @return          - counter value in ticks
+**/
+uint32_t pal_timestamp_start_ns(void)
+{
+    pal_systick_restart();
+    return pal_systick_get_count();
+}
+
+/**
+    @brief           - Returns whether SysTick reached zero since pal_timestamp_start_ns
+    @param           - void
+    @return          - 1 if COUNTFLAG was set, else 0
+**/
+uint32_t pal_timestamp_wrapped_ns(void)
+{
+    return pal_systick_wrapped();
+}
+
+/**
+    @brief           - Returns the number of heap bytes in use by the implementation under
+                       test. The crypto service runs in the secure world, whose heap is
+                       not visible from here.
+    @param           - bytes   : Heap bytes in use
+    @return          - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_heap_used_ns(uint32_t *bytes)
+{
+    (void)bytes;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+    @brief    - Appends a record to the PSA call trace. There is no file system to hold
+                the trace on this target.
+    @param    - data    : Record
+                size    : Record size in bytes
+    @return   - PAL_STATUS_UNSUPPORTED_FUNC
+**/
+int pal_call_trace_write_ns(const void *data, uint32_t size)
+{
+    (void)data;
+    (void)size;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
 /**
     @brief    - Reads from given non-volatile address.
     @param    - base    : Base address of nvmem
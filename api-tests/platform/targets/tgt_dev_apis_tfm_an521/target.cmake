@@ -37,6 +37,7 @@ else()
 		${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
 		${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk/pal_uart.c
 		${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk/pal_wd_cmsdk.c
+		${PSA_ROOT_DIR}/platform/drivers/timer/systick/pal_systick.c
 	)
 endif()
 
@@ -78,6 +79,7 @@ list(APPEND PAL_DRIVER_INCLUDE_PATHS
 	${PSA_ROOT_DIR}/platform/drivers/nvmem
 	${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk
 	${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk
+	${PSA_ROOT_DIR}/platform/drivers/timer/systick
 )
 
 target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
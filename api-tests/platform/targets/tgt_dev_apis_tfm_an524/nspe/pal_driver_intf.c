@@ -78,6 +78,18 @@ int pal_wd_timer_disable_ns(addr_t base_addr)
     return pal_wd_cmsdk_disable(base_addr);
 }
 
+/**
+    @brief           - Returns the time elapsed since the watchdog was last enabled
+    @param           - base_addr       : Base address of the watchdog module
+                     - timer_tick_us   : Number of ticks per micro second
+                     - elapsed_us      : Elapsed time in micro seconds
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_elapsed_ns(addr_t base_addr, uint32_t timer_tick_us, uint32_t *elapsed_us)
+{
+    return pal_wd_cmsdk_elapsed(base_addr, timer_tick_us, elapsed_us);
+}
+
 /**
     @brief    - Reads from given non-volatile address.
     @param    - base    : Base address of nvmem
@@ -130,3 +130,44 @@ void pal_disable_interrupt(void)
 {
     pal_uart_cmsdk_disable_irq();
 }
+
+/**
+    @brief   - Starts the free running counter used to timestamp driver partition events
+    @param   - void
+    @return  - void
+**/
+void pal_timestamp_init(void)
+{
+    pal_systick_init();
+}
+
+/**
+    @brief   - Returns the current value of the free running counter
+    @param   - void
+    @return  - counter value in ticks
+**/
+uint32_t pal_timestamp_get(void)
+{
+    return pal_systick_get_count();
+}
+
+/**
+    @brief   - Returns the number of ticks between two values returned by pal_timestamp_get
+    @param   - start   : timestamp taken first
+               end     : timestamp taken last
+    @return  - elapsed ticks
+**/
+uint32_t pal_timestamp_elapsed(uint32_t start, uint32_t end)
+{
+    return pal_systick_elapsed(start, end);
+}
+
+/**
+    @brief   - Returns the number of counter ticks per micro second
+    @param   - void
+    @return  - ticks per micro second
+**/
+uint32_t pal_timestamp_ticks_per_us(void)
+{
+    return TIMESTAMP_TICKS_PER_US;
+}
@@ -39,6 +39,7 @@ if(${SUITE} STREQUAL "IPC")
 		# Driver files will be compiled as part of driver partition
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/spe/pal_driver_intf.c
 		${PSA_ROOT_DIR}/platform/drivers/nvmem/pal_nvmem.c
+		${PSA_ROOT_DIR}/platform/drivers/timer/systick/pal_systick.c
 		${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk/pal_uart.c
 		${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk/pal_wd_cmsdk.c
 	)
@@ -62,6 +63,7 @@ endforeach()
 
 list(APPEND PAL_DRIVER_INCLUDE_PATHS
 	${PSA_ROOT_DIR}/platform/drivers/nvmem
+	${PSA_ROOT_DIR}/platform/drivers/timer/systick
 	${PSA_ROOT_DIR}/platform/drivers/uart/cmsdk
 	${PSA_ROOT_DIR}/platform/drivers/watchdog/cmsdk
 )
@@ -20,8 +20,12 @@
 
 #include "pal_uart.h"
 #include "pal_nvmem.h"
+#include "pal_systick.h"
 #include "pal_wd_cmsdk.h"
 
+/* SysTick timestamp counter rate, 50 MHz system clock */
+#define TIMESTAMP_TICKS_PER_US  50
+
 void pal_uart_init(uint32_t uart_base_addr);
 void pal_print(const char *str, int32_t data);
 int pal_nvmem_write(addr_t base, uint32_t offset, void *buffer, int size);
@@ -32,4 +36,8 @@ int pal_wd_timer_disable(addr_t base_addr);
 int pal_wd_timer_is_enabled(addr_t base_addr);
 void pal_generate_interrupt(void);
 void pal_disable_interrupt(void);
+void pal_timestamp_init(void);
+uint32_t pal_timestamp_get(void);
+uint32_t pal_timestamp_elapsed(uint32_t start, uint32_t end);
+uint32_t pal_timestamp_ticks_per_us(void);
 #endif /* _PAL_DRIVER_INTF_H_ */
@@ -23,6 +23,10 @@
 
 #include "pal_uart.h"
 #include "pal_nvmem.h"
+#include "pal_systick.h"
+
+/* SysTick timestamp counter rate, 64 MHz system clock */
+#define TIMESTAMP_TICKS_PER_US  64
 
 /* Following defines should be used for structure members */
 #define     __IM     volatile const      /*! Defines 'read only' structure member permissions */
@@ -71,4 +75,8 @@ int pal_wd_timer_disable(addr_t base_addr);
 int pal_wd_timer_is_enabled(addr_t base_addr);
 void pal_generate_interrupt(void);
 void pal_disable_interrupt(void);
+void pal_timestamp_init(void);
+uint32_t pal_timestamp_get(void);
+uint32_t pal_timestamp_elapsed(uint32_t start, uint32_t end);
+uint32_t pal_timestamp_ticks_per_us(void);
 #endif /* _PAL_DRIVER_INTF_H_ */
@@ -0,0 +1,161 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# Benchmark baseline handling. The benchmark tests report their metrics on lines
+#     PERF|<test>|<name>|<index>|<value>|<iterations>
+# The hardware counters of a -DPERF_COUNTERS build, on lines
+#     COUNTERS|<test>|<check>|<instructions>|<cycles>|<cache misses>|<branch misses>
+# are metrics too, named after the counter and indexed by check, with 0 iterations as
+# they are exact counts. Only the counters given with --counters are collected, by
+# default the instruction count, the one counter that is stable across machines.
+# A baseline file holds one metric per line, the median over the saved runs:
+#     <test> <name> <index> <value> <iterations>
+#
+# save    <baseline> <log>...  : save the median of the metrics of N run logs
+# compare <baseline> <log>...  : compare the median of N run logs with a baseline
+# gen     <baseline> <inc>     : generate the C table used by -DBENCHMARK_BASELINE
+
+import sys, re, argparse
+
+PERF_LINE = re.compile(r'PERF\|(\d+)\|([^|\s]+)\|(\d+)\|(\d+)\|(\d+)')
+COUNTERS_LINE = re.compile(r'COUNTERS\|(\d+)\|(\d+)((?:\|(?:\d+|-)){4})')
+COUNTER_NAMES = ["instructions", "cycles", "cache_misses", "branch_misses"]
+
+def median(values):
+    values = sorted(values)
+    mid = len(values) // 2
+    if len(values) % 2:
+        return values[mid]
+    return (values[mid - 1] + values[mid]) // 2
+
+# Median of every metric over the given logs, with the fewest iterations seen
+def collect_metrics(logs, counters):
+    samples = {}
+    for log in logs:
+        with open(log, 'r', errors='replace') as f:
+            for line in f:
+                m = PERF_LINE.search(line)
+                if m:
+                    key = (int(m.group(1)), m.group(2), int(m.group(3)))
+                    samples.setdefault(key, []).append((int(m.group(4)), int(m.group(5))))
+                    continue
+                m = COUNTERS_LINE.search(line)
+                if not m:
+                    continue
+                values = m.group(3).split('|')[1:]
+                for name, value in zip(COUNTER_NAMES, values):
+                    if name in counters and value != '-':
+                        key = (int(m.group(1)), name, int(m.group(2)))
+                        samples.setdefault(key, []).append((int(value), 0))
+
+    metrics = {}
+    for key, values in samples.items():
+        metrics[key] = (median([v for v, _ in values]), min([n for _, n in values]))
+    return metrics
+
+def read_baseline(baseline):
+    metrics = {}
+    with open(baseline, 'r') as f:
+        for line in f:
+            fields = line.split()
+            if not fields or fields[0].startswith('#'):
+                continue
+            if len(fields) != 5:
+                sys.exit("Error: malformed baseline line '%s'" % line.strip())
+            metrics[(int(fields[0]), fields[1], int(fields[2]))] = (int(fields[3]),
+                                                                     int(fields[4]))
+    return metrics
+
+def save(args):
+    metrics = collect_metrics(args.logs, args.counters)
+    if not metrics:
+        sys.exit("Error: no PERF metrics found in the logs")
+    with open(args.baseline, 'w') as f:
+        f.write("# Benchmark baseline, median of %d run(s)\n" % len(args.logs))
+        f.write("# <test> <name> <index> <value> <iterations>\n")
+        for key in sorted(metrics):
+            f.write("%d %s %d %d %d\n" % (key + metrics[key]))
+    print("Saved %d metrics to %s" % (len(metrics), args.baseline))
+
+def compare(args):
+    baseline = read_baseline(args.baseline)
+    metrics  = collect_metrics(args.logs, args.counters)
+    regressions = 0
+
+    for key in sorted(metrics):
+        value, iterations = metrics[key]
+        name = "%d %s[%d]" % key
+        if key not in baseline:
+            print("%-48s %10d   no baseline" % (name, value))
+            continue
+        reference = baseline[key][0]
+        percent = (value * 100) // reference if reference else 0
+        if 0 < iterations < args.min_iterations:
+            status = "NOISY (%d iterations)" % iterations
+        elif value * 100 > reference * (100 + args.threshold):
+            status = "PERF REGRESSION"
+            regressions += 1
+        else:
+            status = "PASSED"
+        print("%-48s %10d %4d%%  %s" % (name, value, percent, status))
+
+    for key in sorted(set(baseline) - set(metrics)):
+        print("%-48s %10s   not reported" % ("%d %s[%d]" % key, "-"))
+
+    print("TOTAL PERF REGRESSION : %d" % regressions)
+    return 1 if regressions else 0
+
+def gen(args):
+    metrics = read_baseline(args.baseline)
+    with open(args.inc, 'w') as f:
+        for key in sorted(metrics):
+            # Counter metrics are compared on the host only
+            if metrics[key][1] == 0:
+                continue
+            f.write('{%d, "%s", %d, %d},\n' % (key[0], key[1], key[2], metrics[key][0]))
+
+parser = argparse.ArgumentParser(description="Benchmark baseline save and compare")
+sub = parser.add_subparsers(dest="mode")
+p = sub.add_parser("save", help="save the median metrics of one or more run logs")
+p.add_argument("baseline")
+p.add_argument("logs", nargs="+")
+p = sub.add_parser("compare", help="compare one or more run logs with a baseline")
+p.add_argument("baseline")
+p.add_argument("logs", nargs="+")
+p.add_argument("--threshold", type=int, default=10,
+               help="allowed slowdown in percent (default 10)")
+p.add_argument("--min-iterations", type=int, default=8,
+               help="fewest timed iterations for a metric to be compared (default 8)")
+for p in sub.choices["save"], sub.choices["compare"]:
+    p.add_argument("--counters", type=lambda s: s.split(","), default=["instructions"],
+                   help="comma separated hardware counters to collect from COUNTERS lines, "
+                        "among %s (default instructions)" % ",".join(COUNTER_NAMES))
+p = sub.add_parser("gen", help="generate the baseline table of a -DBENCHMARK_BASELINE build")
+p.add_argument("baseline")
+p.add_argument("inc")
+args = parser.parse_args()
+
+if args.mode == "save":
+    save(args)
+elif args.mode == "compare":
+    sys.exit(compare(args))
+elif args.mode == "gen":
+    gen(args)
+else:
+    parser.print_help()
+    sys.exit(1)
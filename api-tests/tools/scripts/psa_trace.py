@@ -0,0 +1,437 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# PSA call trace tool, for the traces recorded by a -DPSA_CALL_TRACE=1 build. The trace
+# format and the argument signatures are described in val/nspe/val_call_trace.h and .c
+#
+# show    <trace>              : print the calls of a trace
+# compare <trace> <trace>      : compare the results and latency of two traces of the
+#                                same test run, e.g. recorded with two PSA implementations
+# replay  <trace> <library>    : replay the calls of a trace against the PSA implementation
+#                                of a shared object, and compare the results and latency
+
+import sys, struct, argparse, ctypes, time
+
+MAGIC        = 0x54415350
+VERSION      = 1
+KIND_DESC    = 1
+KIND_CALL    = 2
+TRACE_HASHED = 0x1
+FLAG_REPLAY  = 0x1
+FLAG_COMPARE = 0x2
+BUF_HASHED   = 0x80000000
+API_NAMES    = {1: "crypto", 2: "its", 3: "ps", 4: "attestation"}
+OUTPUTS      = "oNfaSKZ"
+
+def fnv1a(data):
+    h = 0x811C9DC5
+    for b in data:
+        h = ((h ^ b) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+class Desc:
+    def __init__(self, api, type, flags, name, sig):
+        self.api, self.type, self.flags, self.name, self.sig = api, type, flags, name, sig
+
+    def label(self):
+        if self.name:
+            return self.name
+        return "%s[0x%02x]" % (API_NAMES.get(self.api, "api%d" % self.api), self.type)
+
+class Call:
+    pass
+
+class Reader:
+    def __init__(self, data, pos=0):
+        self.data, self.pos = data, pos
+
+    def take(self, n):
+        if self.pos + n > len(self.data):
+            raise ValueError("truncated record")
+        chunk = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return chunk
+
+    def u32(self):
+        return struct.unpack("<I", self.take(4))[0]
+
+    def u64(self):
+        return struct.unpack("<Q", self.take(8))[0]
+
+# Decodes the payload of a call into its list of inputs, and its list of outputs
+def decode_payload(desc, payload, attr_size):
+    r = Reader(payload)
+    inputs, outputs = [], []
+    for c in desc.sig:
+        if c in "kuwz":
+            inputs.append(r.u32())
+        elif c == "q":
+            inputs.append(r.u64())
+        elif c in "in":
+            length = r.u32()
+            if length & BUF_HASHED:
+                inputs.append(("hash", length & ~BUF_HASHED, r.u32()))
+            else:
+                inputs.append(("data", length, r.take(length)))
+        elif c in "oNfS":
+            inputs.append(r.u32())
+        elif c == "h":
+            inputs.append(r.u32())
+        elif c == "A":
+            inputs.append(r.take(attr_size))
+        else:
+            inputs.append(None)
+    for c in desc.sig:
+        if c in "oN":
+            outputs.append((r.u32(), r.u32()))
+        elif c in "faSKZ":
+            outputs.append(r.u32())
+    return inputs, outputs
+
+def read_trace(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 16:
+        sys.exit("Error: %s is not a PSA call trace" % path)
+    magic, version, flags, ticks_per_us, attr_size, op_size = struct.unpack("<IHHIHH", data[:16])
+    if magic != MAGIC or version != VERSION:
+        sys.exit("Error: %s is not a version %d PSA call trace" % (path, VERSION))
+
+    trace = Call()
+    trace.hashed, trace.ticks_per_us = flags & TRACE_HASHED, ticks_per_us or 1
+    trace.attr_size, trace.op_size = attr_size, op_size
+    trace.calls = []
+    descs = {}
+    pos = 16
+    try:
+        while pos < len(data):
+            kind = data[pos]
+            if kind == KIND_DESC:
+                api, type, dflags, name_len = struct.unpack("<BBBB", data[pos + 1:pos + 5])
+                pos += 5
+                name = data[pos:pos + name_len].decode()
+                pos += name_len
+                sig_len = data[pos]
+                sig = data[pos + 1:pos + 1 + sig_len].decode()
+                pos += 1 + sig_len
+                descs[(api, type)] = Desc(api, type, dflags, name, sig)
+            elif kind == KIND_CALL:
+                _, api, type, _, size, status, duration = struct.unpack("<BBBBIiI",
+                                                                       data[pos:pos + 16])
+                call = Call()
+                call.index = len(trace.calls)
+                call.desc = descs[(api, type)]
+                call.status = status
+                call.ns = duration * 1000 // trace.ticks_per_us
+                call.inputs, call.outputs = decode_payload(call.desc, data[pos + 16:pos + 16 + size],
+                                                           attr_size)
+                trace.calls.append(call)
+                pos += 16 + size
+            else:
+                raise ValueError("unknown record kind %d" % kind)
+    except (ValueError, KeyError, struct.error) as e:
+        # The last record of a test that crashed may be incomplete
+        print("Warning: %s: stopped at offset %d: %s" % (path, pos, e))
+    return trace
+
+def format_inputs(call):
+    fields = []
+    for c, v in zip(call.desc.sig, call.inputs):
+        if c in "in":
+            if v[0] == "hash":
+                fields.append("<%d bytes #%08x>" % (v[1], v[2]))
+            else:
+                fields.append("<%d bytes>" % v[1])
+        elif c == "h":
+            fields.append("op@%08x" % v)
+        elif c == "A":
+            fields.append("attr")
+        elif c in "kuwzqoNfS":
+            fields.append("0x%x" % v)
+    return ", ".join(fields)
+
+def inputs_hashed(call):
+    return any(isinstance(v, tuple) and v[0] == "hash" for v in call.inputs)
+
+def show(args):
+    trace = read_trace(args.trace)
+    for call in trace.calls:
+        print("%6d %-36s %6d %10.3f us  (%s)" % (call.index, call.desc.label(), call.status,
+                                                 call.ns / 1000.0, format_inputs(call)))
+    print("%d calls" % len(trace.calls))
+
+def median(values):
+    values = sorted(values)
+    mid = len(values) // 2
+    if len(values) % 2:
+        return values[mid]
+    return (values[mid - 1] + values[mid]) / 2.0
+
+# Comparable outputs of a call: the output hashes, not the key identifiers
+def output_hashes(call, outputs):
+    hashes = []
+    for c, v in zip([c for c in call.desc.sig if c in OUTPUTS], outputs):
+        if c in "oNfSZ":
+            hashes.append(v)
+    return hashes
+
+# Prints the calls whose result or latency differ, and a summary per PSA function.
+# results holds (call, status, outputs or None, ns) for each compared call, not_replayed
+# the number of calls a replay could not make.
+def report(results, args, not_replayed=None):
+    mismatches = regressions = 0
+    per_function = {}
+    for call, status, outputs, ns in results:
+        notes = []
+        if status != call.status:
+            notes.append("status %d, expected %d" % (status, call.status))
+        elif outputs is not None and status == 0 and \
+                output_hashes(call, outputs) != output_hashes(call, call.outputs):
+            notes.append("output mismatch")
+        if notes:
+            mismatches += 1
+        if ns * 100 > call.ns * (100 + args.threshold) and ns - call.ns > args.min_ns:
+            notes.append("PERF REGRESSION %.3f us, was %.3f us" % (ns / 1000.0, call.ns / 1000.0))
+            regressions += 1
+        if notes:
+            print("%6d %-36s %s" % (call.index, call.desc.label(), "; ".join(notes)))
+        per_function.setdefault(call.desc.label(), []).append((call.ns, ns))
+
+    print("\n%-36s %8s %12s %12s %7s" % ("function", "calls", "median us", "was us", "ratio"))
+    for name in sorted(per_function):
+        was = median([a for a, _ in per_function[name]])
+        now = median([b for _, b in per_function[name]])
+        print("%-36s %8d %12.3f %12.3f %6.2fx" % (name, len(per_function[name]), now / 1000.0,
+                                                  was / 1000.0, (now / was) if was else 0))
+    print("\nTOTAL CALLS COMPARED : %d" % len(results))
+    print("TOTAL MISMATCH : %d" % mismatches)
+    print("TOTAL PERF REGRESSION : %d" % regressions)
+    if not_replayed is not None:
+        print("TOTAL NOT REPLAYABLE : %d" % not_replayed)
+    return 1 if mismatches or regressions else 0
+
+def compare(args):
+    reference = read_trace(args.reference)
+    trace = read_trace(args.trace)
+    results = []
+    for a, b in zip(reference.calls, trace.calls):
+        if (a.desc.api, a.desc.type) != (b.desc.api, b.desc.type):
+            print("Calls diverge at %d: %s, expected %s" % (a.index, b.desc.label(),
+                                                            a.desc.label()))
+            break
+        compare_outputs = (a.desc.flags & FLAG_COMPARE) and not inputs_hashed(a)
+        results.append((a, b.status, b.outputs if compare_outputs else None, b.ns))
+    if len(reference.calls) != len(trace.calls):
+        print("Traces hold %d and %d calls" % (len(reference.calls), len(trace.calls)))
+    return report(results, args)
+
+class Replay:
+    def __init__(self, trace, lib):
+        self.trace, self.lib = trace, lib
+        self.keys = {}          # recorded key identifier -> replayed key identifier
+        self.tainted = set()    # replayed keys and operations with unpredictable content
+        self.ops = {}           # recorded operation handle -> operation object
+        self.created = []       # keys created since the last VAL_CRYPTO_FREE
+        self.dropped = set()    # recorded keys and operations of calls that were not replayed
+
+    def op(self, handle):
+        if handle not in self.ops:
+            self.ops[handle] = ctypes.create_string_buffer(self.trace.op_size)
+        return self.ops[handle]
+
+    # Local calls served by the test suite itself, only operation initialisation and the
+    # key clean up of VAL_CRYPTO_FREE, which VAL_CRYPTO_UNTRACK_KEY opts a key out of,
+    # affect the replay
+    def local(self, call):
+        if call.desc.sig == "h":
+            handle = call.inputs[0]
+            self.ops[handle] = ctypes.create_string_buffer(self.trace.op_size)
+            self.tainted.discard(("op", handle))
+            self.dropped.discard(("op", handle))
+        elif call.desc.api == 1 and call.desc.type == 0xFE:
+            for key in self.created:
+                self.lib.psa_destroy_key(ctypes.c_uint32(key))
+            self.created = []
+        elif call.desc.api == 1 and call.desc.type == 0xFD:
+            key = self.keys.get(call.inputs[0], call.inputs[0])
+            if key in self.created:
+                self.created.remove(key)
+
+    # A call with a hashed input, as recorded by -DPSA_CALL_TRACE_HASH=1 or for a buffer
+    # larger than the record, cannot be made without its data, and neither can the later
+    # calls on the keys and operations it would have created or updated
+    def replayable(self, call):
+        if inputs_hashed(call):
+            return False
+        for c, v in zip(call.desc.sig, call.inputs):
+            if (c == "k" and ("key", v) in self.dropped) or (c == "h" and ("op", v) in self.dropped):
+                return False
+        return True
+
+    def drop(self, call):
+        for c, v in zip(call.desc.sig, call.inputs):
+            if c == "h":
+                self.dropped.add(("op", v))
+        for c, v in zip([c for c in call.desc.sig if c in OUTPUTS], call.outputs):
+            if c == "K" and call.status == 0:
+                self.dropped.add(("key", v))
+
+    def call(self, call):
+        sig, fn = call.desc.sig, getattr(self.lib, call.desc.name, None)
+        if fn is None:
+            return None
+        fn.restype = ctypes.c_int32
+        argv, outs = [], []
+        tainted = not (call.desc.flags & FLAG_COMPARE)
+        for c, v in zip(sig, call.inputs):
+            if c == "k":
+                tainted |= ("key", v) in self.tainted
+                argv.append(ctypes.c_uint32(self.keys.get(v, v)))
+            elif c == "u":
+                argv.append(ctypes.c_uint32(v))
+            elif c in "zw":
+                argv.append(ctypes.c_size_t(v))
+            elif c == "q":
+                argv.append(ctypes.c_uint64(v))
+            elif c in "in":
+                data = v[2]
+                buf = ctypes.create_string_buffer(data, max(len(data), 1))
+                if c == "i":
+                    argv += [buf, ctypes.c_size_t(len(data))]
+                else:
+                    argv += [ctypes.c_size_t(len(data)), buf]
+            elif c in "oN":
+                buf, length = ctypes.create_string_buffer(max(v, 1)), ctypes.c_size_t(0)
+                if c == "o":
+                    argv += [buf, ctypes.c_size_t(v), ctypes.byref(length)]
+                else:
+                    argv += [ctypes.c_size_t(v), buf, ctypes.byref(length)]
+                outs.append((c, buf, length))
+            elif c == "f":
+                buf = ctypes.create_string_buffer(max(v, 1))
+                argv += [buf, ctypes.c_size_t(v)]
+                outs.append((c, buf, v))
+            elif c == "S":
+                buf = ctypes.create_string_buffer(max(v, 1))
+                argv.append(buf)
+                outs.append((c, buf, v))
+            elif c == "h":
+                tainted |= ("op", v) in self.tainted
+                argv.append(self.op(v))
+            elif c == "A":
+                argv.append(ctypes.create_string_buffer(v, len(v)))
+            elif c == "a":
+                buf = ctypes.create_string_buffer(max(self.trace.attr_size, 1))
+                argv.append(buf)
+                outs.append((c, buf, self.trace.attr_size))
+            elif c == "K":
+                key = ctypes.c_uint32(0)
+                argv.append(ctypes.byref(key))
+                outs.append((c, key, None))
+            elif c == "Z":
+                value = ctypes.c_size_t(0)
+                argv.append(ctypes.byref(value))
+                outs.append((c, value, None))
+
+        start = time.perf_counter_ns()
+        status = fn(*argv)
+        ns = time.perf_counter_ns() - start
+
+        outputs = []
+        for c, obj, extra in outs:
+            if c in "oN":
+                length = min(extra.value, len(obj))
+                outputs.append((length, fnv1a(obj.raw[:length]) if status == 0 else 0))
+            elif c in "faS":
+                outputs.append(fnv1a(obj.raw[:extra]) if status == 0 else 0)
+            else:
+                outputs.append(obj.value if status == 0 else 0)
+
+        # Map the created keys, and carry the taint of the inputs to the outputs
+        for (c, obj, _), recorded in zip(outs, call.outputs):
+            if c == "K" and status == 0:
+                self.keys[recorded] = obj.value
+                self.dropped.discard(("key", recorded))
+                self.created.append(obj.value)
+                if tainted:
+                    self.tainted.add(("key", obj.value))
+        if tainted:
+            for c, v in zip(sig, call.inputs):
+                if c == "h":
+                    self.tainted.add(("op", v))
+        return status, (None if tainted else outputs), ns
+
+def replay(args):
+    trace = read_trace(args.trace)
+    if trace.hashed:
+        print("Warning: the input buffers of this trace are hashed, calls taking one are not replayed")
+    try:
+        lib = ctypes.CDLL(args.library)
+    except OSError as e:
+        sys.exit("Error: %s" % e)
+    state = Replay(trace, lib)
+    results = []
+    skipped = set()
+    dropped = {}
+    for call in trace.calls:
+        if not (call.desc.flags & FLAG_REPLAY):
+            state.local(call)
+            continue
+        if not state.replayable(call):
+            state.drop(call)
+            dropped[call.desc.label()] = dropped.get(call.desc.label(), 0) + 1
+            continue
+        result = state.call(call)
+        if result is None:
+            skipped.add(call.desc.name)
+            continue
+        status, outputs, ns = result
+        results.append((call, status, outputs, ns))
+    for name in sorted(skipped):
+        print("Not replayed, %s is not exported by %s" % (name, args.library))
+    for name in sorted(dropped):
+        print("Not replayable, %d %s calls with a hashed input, or on the result of one" %
+              (dropped[name], name))
+    return report(results, args, sum(dropped.values()))
+
+parser = argparse.ArgumentParser(description="PSA call trace show, compare and replay")
+sub = parser.add_subparsers(dest="mode")
+p = sub.add_parser("show", help="print the calls of a trace")
+p.add_argument("trace")
+p = sub.add_parser("compare", help="compare a trace with a reference trace of the same tests")
+p.add_argument("reference")
+p.add_argument("trace")
+p = sub.add_parser("replay", help="replay a trace against the PSA implementation of a library")
+p.add_argument("trace")
+p.add_argument("library")
+for p in sub.choices["compare"], sub.choices["replay"]:
+    p.add_argument("--threshold", type=int, default=25,
+                   help="allowed slowdown of a call in percent (default 25)")
+    p.add_argument("--min-ns", type=int, default=2000,
+                   help="slowdowns below this many nanoseconds are noise (default 2000)")
+args = parser.parse_args()
+
+if args.mode == "show":
+    show(args)
+elif args.mode == "compare":
+    sys.exit(compare(args))
+elif args.mode == "replay":
+    sys.exit(replay(args))
+else:
+    parser.print_help()
+    sys.exit(1)
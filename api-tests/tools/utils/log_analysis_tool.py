@@ -190,7 +190,7 @@ def cryptoDataExtraction(fname, testsuite):
             gtoplevel.Scrolledtreeview1.insert(parent=testsuite, index='end', iid="basic", text="Basic")
             gtoplevel.Scrolledtreeview1.insert(parent="basic", index='end', iid="psa_crypto_init", text="psa_crypto_init")
             test_num = re.search(r'(.*?)\sDESCRIPTION:', i).group(1)
-            test_result = re.search(r'TEST\sRESULT:\s(.*?)\s', i).group(1)
+            test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)', i).group(1)
             b = test_num + " " + test_result
             b_temp = b.replace(" ","")
             gtoplevel.Scrolledtreeview1.insert(parent="psa_crypto_init", index='end', iid=b_temp, text=b)
@@ -199,9 +199,20 @@ def cryptoDataExtraction(fname, testsuite):
             x = re.search(rf'^TEST:\s[0-9]+\s\|\sDESCRIPTION:\sTesting\s{testsuite}\s(.*?)\sAPIs', i).group(1)
             firstlevel.append(x) if x not in firstlevel else firstlevel
 
+        # Benchmark tests (-DBENCHMARK=1) are grouped under a single node
+        if re.search(r'^TEST:\s[0-9]+\s\|\sDESCRIPTION:\sBenchmarking\s', i):
+            if not gtoplevel.Scrolledtreeview1.exists("benchmark"):
+                gtoplevel.Scrolledtreeview1.insert(parent=testsuite, index='end', iid="benchmark", text="Benchmark")
+            test_num = re.search(r'(.*?)\sDESCRIPTION:', i).group(1)
+            test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)', i).group(1)
+            b = test_num + " " + test_result
+            b_temp = "bench_" + b.replace(" ", "")
+            gtoplevel.Scrolledtreeview1.insert(parent="benchmark", index='end', iid=b_temp, text=b)
+
     if not firstlevel:
-        messagebox.showerror("Error", "Test Suite File must be in required format.")
-        clearTree()
+        if not gtoplevel.Scrolledtreeview1.exists("benchmark"):
+            messagebox.showerror("Error", "Test Suite File must be in required format.")
+            clearTree()
         return
 
     for record in firstlevel:
@@ -226,7 +237,7 @@ def cryptoDataExtraction(fname, testsuite):
                 if re.search(rf'^TEST:\s[0-9]+\s\|\sDESCRIPTION:\sTesting\s{testsuite}\s{i}\sAPIs\n', m):
                     if re.search(rf'\[Check\s1\]\sTest\s{k}\s.*\n', m):
                         test_num = re.search(r'(.*?)\sDESCRIPTION:', m).group(1)
-                        test_result = re.search(r'TEST\sRESULT:\s(.*?)\s', m).group(1)
+                        test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)', m).group(1)
                         b = test_num + " " + test_result
                         thirdlevel.append(b) if b not in thirdlevel else thirdlevel
 
@@ -262,7 +273,7 @@ def attestationDataExtraction(fname, testsuite):
         for t in tests:
             if re.search(rf'\[Check\s1\]\sTest\s{j}\s.*\n', t):
                 test_num = re.search(r'(.*?)\sDESCRIPTION:', t).group(1)
-                test_result = re.search(r'TEST\sRESULT:\s(.*?)\s', t).group(1)
+                test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)', t).group(1)
                 b = test_num + " " + test_result
                 gtoplevel.Scrolledtreeview1.insert(parent=j, index='end', iid=b, text=b)
 
@@ -277,7 +288,7 @@ def storageDataExtraction(fname, testsuite):
     gtoplevel.Scrolledtreeview1.insert(parent=testsuite, index='end', iid="PS", text="PS")
     for i in tests:
         test_num = re.search(r'(.*?)\sDESCRIPTION:', i).group(1)
-        test_result = re.search(r'TEST\sRESULT:\s(.*?)\s', i).group(1)
+        test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)', i).group(1)
         b = test_num + " " + test_result
         b_temp = b.replace(" ", "")
         if re.search(r'\[Info\]\sExecuting\sITS\stests\n', i):
@@ -337,7 +348,7 @@ def testsuiteDataExtraction(fname, testsuite):
             for m in tests:
                 if re.search(rf'^TEST:\s[0-9]+\s\|\sDESCRIPTION:\sTesting\s{testsuite}\s{i}\sAPIs\s\|\sUT:\s{k}\n', m):
                     test_num = re.search(r'(.*?)\sDESCRIPTION:',m).group(1)
-                    test_result = re.search(r'TEST\sRESULT:\s(.*?)\s',m).group(1)
+                    test_result = re.search(r'TEST\sRESULT:\s([A-Z]+(?:\s[A-Z]+)*)',m).group(1)
                     b = test_num+" "+test_result
                     thirdlevel.append(b) if b not in thirdlevel else thirdlevel
 
@@ -357,6 +368,7 @@ def summary_result():
     failed = 0
     skipped = 0
     sim_error = 0
+    perf_regression = 0
     clearText()
     selected_item = gtoplevel.Scrolledtreeview1.selection()[0]
 
@@ -367,6 +379,7 @@ def summary_result():
             failed = 0
             skipped = 0
             sim_error = 0
+            perf_regression = 0
             secondlevel = gtoplevel.Scrolledtreeview1.get_children(child)
             if not secondlevel:
                 result = gtoplevel.Scrolledtreeview1.item(child)['text']
@@ -380,6 +393,8 @@ def summary_result():
                         skipped = skipped + 1
                     if r == "SIM ERROR":
                         sim_error = sim_error + 1
+                    if r == "PERF REGRESSION":
+                        perf_regression = perf_regression + 1
 
             else:
                 for c in secondlevel:
@@ -397,12 +412,15 @@ def summary_result():
                                 skipped = skipped + 1
                             if r == "SIM ERROR":
                                 sim_error = sim_error + 1
+                            if r == "PERF REGRESSION":
+                                perf_regression = perf_regression + 1
 
-            total_test = passed + failed + skipped + sim_error
+            total_test = passed + failed + skipped + sim_error + perf_regression
             data1 = "************ "+child+" Summary Report ************\nTOTAL TESTS   :" + str(
                 total_test) + "\nTOTAL PASSED    :" + str(
                 passed) + "\nTOTAL SIM ERROR :" + str(sim_error) + "\nTOTAL FAILED   :" + str(
-                failed) + "\nTOTAL SKIPPED   :" + str(skipped) + "\n***********************************************\n"
+                failed) + "\nTOTAL SKIPPED   :" + str(skipped) + "\nTOTAL PERF REGRESSION :" + str(
+                perf_regression) + "\n***********************************************\n"
             gtoplevel.Scrolledtext1.insert(END, data1)
     else:
         firstlevel = gtoplevel.Scrolledtreeview1.get_children(selected_item)
@@ -424,6 +442,8 @@ def summary_result():
                             skipped = skipped + 1
                         if r == "SIM ERROR":
                             sim_error = sim_error + 1
+                        if r == "PERF REGRESSION":
+                            perf_regression = perf_regression + 1
                 else:
                     for c in secondlevel:
                         thirdlevel = gtoplevel.Scrolledtreeview1.get_children(c)
@@ -440,6 +460,8 @@ def summary_result():
                                     skipped = skipped + 1
                                 if r == "SIM ERROR":
                                     sim_error = sim_error + 1
+                                if r == "PERF REGRESSION":
+                                    perf_regression = perf_regression + 1
                         else:
                             for c1 in thirdlevel:
                                 fourthlevel = gtoplevel.Scrolledtreeview1.get_children(c1)
@@ -455,11 +477,14 @@ def summary_result():
                                             skipped = skipped + 1
                                         if r == "SIM ERROR":
                                             sim_error = sim_error + 1
+                                        if r == "PERF REGRESSION":
+                                            perf_regression = perf_regression + 1
 
-            total_test = passed + failed + skipped + sim_error
+            total_test = passed + failed + skipped + sim_error + perf_regression
             data1 = "************ Summary Report ************\nTOTAL TESTS   :" + str(total_test) + "\nTOTAL PASSED    :" + str(
                 passed) + "\nTOTAL SIM ERROR :" + str(sim_error) + "\nTOTAL FAILED   :" + str(
-                failed) + "\nTOTAL SKIPPED   :" + str(skipped) + "\n******************************************"
+                failed) + "\nTOTAL SKIPPED   :" + str(skipped) + "\nTOTAL PERF REGRESSION :" + str(
+                perf_regression) + "\n******************************************"
             gtoplevel.Scrolledtext1.insert(END, data1)
 
 
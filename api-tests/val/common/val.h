@@ -51,6 +51,7 @@
 #define TEST_FAIL                  0x08
 #define TEST_SKIP                  0x10
 #define TEST_PENDING               0x20
+#define TEST_PERF_REGRESSION       0x40
 
 #define TEST_NUM_BIT                 32
 #define TEST_STATE_BIT                8
@@ -66,6 +67,8 @@
 #define RESULT_FAIL(status)     (((TEST_FAIL) << TEST_STATE_BIT) | ((status) << TEST_STATUS_BIT))
 #define RESULT_SKIP(status)     (((TEST_SKIP) << TEST_STATE_BIT) | ((status) << TEST_STATUS_BIT))
 #define RESULT_PENDING(status)  (((TEST_PENDING) << TEST_STATE_BIT) | ((status) << TEST_STATUS_BIT))
+#define RESULT_PERF_REGRESSION(status) \
+                        (((TEST_PERF_REGRESSION) << TEST_STATE_BIT) | ((status) << TEST_STATUS_BIT))
 
 #define IS_TEST_FAIL(status)    (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_FAIL)
 #define IS_TEST_PASS(status)    (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_PASS)
@@ -73,6 +76,8 @@
 #define IS_TEST_PENDING(status) (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_PENDING)
 #define IS_TEST_START(status)   (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_START)
 #define IS_TEST_END(status)     (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_END)
+#define IS_TEST_PERF_REGRESSION(status) \
+                        (((status >> TEST_STATE_BIT) & TEST_STATE_MASK) == TEST_PERF_REGRESSION)
 #define VAL_ERROR(status)       ((status & TEST_STATUS_MASK) ? 1 : 0)
 
 
@@ -113,6 +118,58 @@
 
 #define VAL_NVMEM_BLOCK_SIZE           4
 #define VAL_NVMEM_OFFSET(nvmem_idx)    (nvmem_idx * VAL_NVMEM_BLOCK_SIZE)
+#define VAL_NVMEM_MAX_WRITE_SIZE       256
+#define VAL_NV_JOURNAL_MARKER          0x4a524e4c
+#define VAL_NV_JOURNAL_RECORDS         8
+#define VAL_WD_PROFILE_MARKER          0x57445046
+#define VAL_WD_PROFILE_ENTRIES         128
+#define VAL_TRACE_RECORDS              12
+#define VAL_RESULT_MAP_MARKER          0x52534c54
+#define VAL_RESULT_MAP_ENTRIES         128
+#define VAL_RESULT_MAP_BITS            4
+#define VAL_RESULT_MAP_MASK            0xF
+
+/* Suite the NV_RESULT_MAP is recorded for, mixed into its marker word so that a
+   map recorded by another suite, which reuses the same test numbers, is not read back */
+#if defined(IPC)
+#define VAL_RESULT_MAP_SUITE           0x1
+#elif defined(CRYPTO)
+#define VAL_RESULT_MAP_SUITE           0x2
+#elif defined(INTERNAL_TRUSTED_STORAGE)
+#define VAL_RESULT_MAP_SUITE           0x3
+#elif defined(PROTECTED_STORAGE)
+#define VAL_RESULT_MAP_SUITE           0x4
+#elif defined(STORAGE)
+#define VAL_RESULT_MAP_SUITE           0x5
+#elif defined(INITIAL_ATTESTATION)
+#define VAL_RESULT_MAP_SUITE           0x6
+#else
+#define VAL_RESULT_MAP_SUITE           0x0
+#endif
+#define VAL_RESULT_MAP_ID              (VAL_RESULT_MAP_MARKER ^ (VAL_RESULT_MAP_SUITE << 24))
+
+/* Adaptive watchdog timeout: observed maximum * margin, never below the floor */
+#ifndef VAL_WD_ADAPTIVE_MARGIN
+#define VAL_WD_ADAPTIVE_MARGIN         4
+#endif
+#ifndef VAL_WD_ADAPTIVE_MIN_US
+#define VAL_WD_ADAPTIVE_MIN_US         100000
+#endif
+
+/* Benchmark baseline comparison: allowed slowdown in percent, and fewest timed
+   iterations behind a metric for it to be compared at all */
+#ifndef BENCHMARK_THRESHOLD
+#define BENCHMARK_THRESHOLD            10
+#endif
+#ifndef BENCHMARK_MIN_ITERATIONS
+#define BENCHMARK_MIN_ITERATIONS       8
+#endif
+
+/* PSA call trace: size of the record assembled for one call. Input buffers that do
+   not fit are recorded as a hash, as are all of them with PSA_CALL_TRACE_HASH */
+#ifndef VAL_CALL_TRACE_RECORD_SIZE
+#define VAL_CALL_TRACE_RECORD_SIZE     4096
+#endif
 
 #define UART_INIT_SIGN  0xff
 #define UART_PRINT_SIGN 0xfe
@@ -121,8 +178,16 @@
     do {                                         \
     } while(1)
 
+/* Appends the checkpoint to the NVMEM trace ring, dumped after an unexpected reboot */
+#ifdef CHECKPOINT_TRACE
+#define VAL_TRACE_CHECKPOINT(checkpoint)  val->trace_checkpoint(checkpoint)
+#else
+#define VAL_TRACE_CHECKPOINT(checkpoint)  do {} while (0)
+#endif
+
 #define TEST_ASSERT_EQUAL(arg1, arg2, checkpoint)                                   \
     do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
         if ((arg1) != arg2)                                                         \
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
@@ -134,6 +199,7 @@
 
 #define TEST_ASSERT_DUAL(arg1, status1, status2, checkpoint)                        \
     do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
         if ((arg1) != status1 && (arg1) != status2)                                 \
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
@@ -153,6 +219,7 @@
 
 #define TEST_ASSERT_NOT_EQUAL(arg1, arg2, checkpoint)                               \
     do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
         if ((arg1) == arg2)                                                         \
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
@@ -163,6 +230,7 @@
 
 #define TEST_ASSERT_MEMCMP(buf1, buf2, size, checkpoint)                            \
     do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
         if (memcmp(buf1, buf2, size))                                               \
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d : ", checkpoint);   \
@@ -171,8 +239,34 @@
         }                                                                           \
     } while (0)
 
+/* Latency budget checks. TEST_LATENCY_START takes a timestamp before a PSA call,
+   TEST_LATENCY_END turns it into the duration of the call right after it returns, and
+   TEST_ASSERT_LATENCY checks that duration against the budget of the API class, set per
+   target with the LATENCY_BUDGET_*_US defines of pal_crypto_config.h. Ending the timing
+   before the status assert keeps the assert and its checkpoint trace out of the budget.
+   A call the counter cannot time unambiguously ends as VAL_LATENCY_AMBIGUOUS, which is
+   over any budget */
+#ifdef LATENCY_BUDGET
+#define TEST_LATENCY_START(latency)           ((latency) = val->latency_start())
+#define TEST_LATENCY_END(latency)             ((latency) = val->latency_end(latency))
+
+#define TEST_ASSERT_LATENCY(latency, latency_class, checkpoint)                     \
+    do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
+        if (val->latency_check(latency, latency_class, checkpoint) != VAL_STATUS_SUCCESS) \
+        {                                                                           \
+            return 1;                                                               \
+        }                                                                           \
+    } while (0)
+#else
+#define TEST_LATENCY_START(latency)           ((latency) = 0)
+#define TEST_LATENCY_END(latency)             ((void)(latency))
+#define TEST_ASSERT_LATENCY(latency, latency_class, checkpoint)  ((void)(latency))
+#endif
+
 #define TEST_ASSERT_RANGE(arg1, range1, range2, checkpoint)                         \
     do {                                                                            \
+        VAL_TRACE_CHECKPOINT(checkpoint);                                           \
         if ((arg1) < range1 || (arg1) > range2)                                     \
         {                                                                           \
             val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
@@ -228,14 +322,32 @@ typedef enum {
 
 typedef enum {
     NV_BOOT             = 0x0,
-    NV_TEST_ID_PREVIOUS = 0x1,
-    NV_TEST_ID_CURRENT  = 0x2,
-    NV_TEST_CNT         = 0x3,
+    NV_TEST_ID_PREVIOUS = 0x1, /* Unused, superseded by NV_JOURNAL */
+    NV_TEST_ID_CURRENT  = 0x2, /* Unused, superseded by NV_JOURNAL */
+    NV_TEST_CNT         = 0x3, /* Unused, superseded by NV_JOURNAL */
     NV_TEST_DATA1       = 0x4,
     NV_TEST_DATA2       = 0x5,
     NV_TEST_DATA3       = 0x6,
+    /* VAL_NV_JOURNAL_RECORDS dispatcher bookkeeping records from here */
+    NV_JOURNAL          = 0x7,
+    /* Marker then VAL_WD_PROFILE_ENTRIES per test durations, ADAPTIVE_WATCHDOG only */
+    NV_WD_PROFILE       = 0x37,
+    /* VAL_TRACE_RECORDS checkpoint trace records, CHECKPOINT_TRACE only */
+    NV_TRACE            = 0xB8,
+    /* Marker then VAL_RESULT_MAP_ENTRIES per test results, VAL_RESULT_MAP_BITS each */
+    NV_RESULT_MAP       = 0xE8,
 } nvmem_index_t;
 
+/* Per test outcome recorded in the NV_RESULT_MAP */
+typedef enum {
+    VAL_RESULT_NOT_RUN         = 0x0,
+    VAL_RESULT_PASS            = 0x1,
+    VAL_RESULT_FAIL            = 0x2,
+    VAL_RESULT_SKIP            = 0x3,
+    VAL_RESULT_SIM_ERROR       = 0x4,
+    VAL_RESULT_PERF_REGRESSION = 0x5,
+} val_result_t;
+
 /* enums to report test sub-state */
 typedef enum {
   VAL_STATUS_SUCCESS                     = 0x0,
@@ -270,6 +382,8 @@ typedef enum {
   VAL_STATUS_DRIVER_FN_FAILED            = 0x2C,
   VAL_STATUS_NO_TESTS                    = 0X2D,
   VAL_STATUS_TEST_FAILED                 = 0x2E,
+  VAL_STATUS_PERF_REGRESSION             = 0x2F,
+  VAL_STATUS_LATENCY_EXCEEDED            = 0x30,
   VAL_STATUS_ERROR_MAX                   = INT_MAX,
 } val_status_t;
 
@@ -283,6 +397,37 @@ typedef enum {
     PRINT_ALWAYS  = 9
 } print_verbosity_t;
 
+/* API classes with a latency budget, see TEST_ASSERT_LATENCY */
+typedef enum {
+    VAL_LATENCY_HASH                     = 0x0,
+    VAL_LATENCY_MAC                      = 0x1,
+    VAL_LATENCY_CIPHER                   = 0x2,
+    VAL_LATENCY_AEAD                     = 0x3,
+    VAL_LATENCY_SIGN                     = 0x4,
+    VAL_LATENCY_VERIFY                   = 0x5,
+    VAL_LATENCY_ASYMMETRIC_ENCRYPTION    = 0x6,
+    VAL_LATENCY_KEY_AGREEMENT            = 0x7,
+    VAL_LATENCY_KEY_DERIVATION           = 0x8,
+    VAL_LATENCY_KEY_GENERATION           = 0x9,
+    VAL_LATENCY_RANDOM                   = 0xA,
+    VAL_LATENCY_CLASS_COUNT              = 0xB,
+} val_latency_class_t;
+
+/* Duration of a call that may have outlasted the period of the timestamp counter */
+#define VAL_LATENCY_AMBIGUOUS                    0xFFFFFFFF
+
+/* Framework operations timed by a -DFRAMEWORK_COST build. The dispatch ones are numbered
+   as the APIs of the PSA call trace, and timed per function code */
+typedef enum {
+    VAL_COST_CRYPTO                      = 0x1,
+    VAL_COST_ITS                         = 0x2,
+    VAL_COST_PS                          = 0x3,
+    VAL_COST_ATTESTATION                 = 0x4,
+    VAL_COST_WATCHDOG                    = 0x5,
+    VAL_COST_PRINT                       = 0x6,
+    VAL_COST_OP_COUNT                    = 0x7,
+} val_cost_op_t;
+
 /* Driver test function id enums */
 typedef enum {
     TEST_PSA_EOI_WITH_NON_INTR_SIGNAL    = 1,
@@ -297,6 +442,8 @@ typedef enum {
     TEST_ISOLATION_PSA_ROT_HEAP_WR       = 10,
     TEST_ISOLATION_PSA_ROT_MMIO_RD       = 11,
     TEST_ISOLATION_PSA_ROT_MMIO_WR       = 12,
+    TEST_DOORBELL_LATENCY                = 13,
+    TEST_INTR_LATENCY                    = 14,
 } driver_test_fn_id_t;
 
 /* typedef's */
@@ -309,13 +456,43 @@ typedef struct {
     uint32_t skip_cnt:8;
     uint32_t fail_cnt:8;
     uint32_t sim_error_cnt:8;
+    uint32_t perf_regression_cnt:8;
 } test_count_t;
 
+typedef struct {
+    uint32_t     seq;
+    test_id_t    test_id;
+    uint32_t     checkpoint;
+    uint32_t     elapsed_us;
+} val_trace_record_t;
+
+/* Dispatcher bookkeeping, kept in the NV_JOURNAL ring */
+typedef struct {
+    test_id_t    test_id_previous;
+    test_id_t    test_id_current;
+    test_count_t test_count;
+} val_nv_state_t;
+
+typedef struct {
+    uint32_t       seq;
+    val_nv_state_t state;
+    uint32_t       check;
+} val_nv_journal_record_t;
+
 typedef struct {
     uint16_t test_num;
     uint8_t block_num;
 } test_info_t;
 
+/* Signal latency measured by driver partition, in timestamp ticks */
+typedef struct {
+    uint32_t iterations;
+    uint32_t min_ticks;
+    uint32_t avg_ticks;
+    uint32_t max_ticks;
+    uint32_t ticks_per_us;
+} latency_stats_t;
+
 
 /* struture to capture test state */
 typedef struct {
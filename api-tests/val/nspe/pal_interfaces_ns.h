@@ -60,6 +60,128 @@ int pal_wd_timer_enable_ns(addr_t base_addr);
 **/
 int pal_wd_timer_disable_ns(addr_t base_addr);
 
+/**
+ *   @brief           - Returns the time elapsed since the watchdog was last enabled.
+ *                      Only required when building with -DADAPTIVE_WATCHDOG=1
+ *   @param           - base_addr       : Base address of the watchdog module
+ *                    - timer_tick_us   : Number of ticks per micro second
+ *                    - elapsed_us      : Elapsed time in micro seconds
+ *   @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_elapsed_ns(addr_t base_addr, uint32_t timer_tick_us, uint32_t *elapsed_us);
+
+/**
+ *   @brief           - Starts the free running counter used to time benchmark operations.
+ *                      Only required when building with -DBENCHMARK=1
+ *   @param           - void
+ *   @return          - void
+**/
+void pal_timestamp_init_ns(void);
+
+/**
+ *   @brief           - Returns the current value of the benchmark counter
+ *   @param           - void
+ *   @return          - Counter value in ticks
+**/
+uint32_t pal_timestamp_get_ns(void);
+
+/**
+ *   @brief           - Returns the number of ticks between two values returned by
+ *                      pal_timestamp_get_ns, accounting for a single counter wrap
+ *   @param           - start   : Timestamp taken first
+ *                    - end     : Timestamp taken last
+ *   @return          - Elapsed ticks
+**/
+uint32_t pal_timestamp_elapsed_ns(uint32_t start, uint32_t end);
+
+/**
+ *   @brief           - Returns the rate of the benchmark counter
+ *   @param           - void
+ *   @return          - Number of ticks per micro second
+**/
+uint32_t pal_timestamp_ticks_per_us_ns(void);
+
+/**
+ *   @brief           - Returns a timestamp to time a single call from, and starts the wrap
+ *                      check of pal_timestamp_wrapped_ns. The counter may be restarted, so
+ *                      timestamps taken before must not be compared with later ones.
+ *                      Only required when building with -DLATENCY_BUDGET
+ *   @param           - void
+ *   @return          - Counter value in ticks
+**/
+uint32_t pal_timestamp_start_ns(void);
+
+/**
+ *   @brief           - Returns whether the counter may have completed a full period since
+ *                      pal_timestamp_start_ns, leaving the elapsed ticks ambiguous
+ *   @param           - void
+ *   @return          - 1 if it may have wrapped beyond one period, else 0
+**/
+uint32_t pal_timestamp_wrapped_ns(void);
+
+/**
+ *   @brief           - Returns the number of heap bytes in use by the implementation under
+ *                      test. Only required when building with -DBENCHMARK=1
+ *   @param           - bytes   : Heap bytes in use
+ *   @return          - SUCCESS, or PAL_STATUS_UNSUPPORTED_FUNC if the heap is not visible
+**/
+int pal_heap_used_ns(uint32_t *bytes);
+
+/**
+ *   @brief           - Appends a record to the PSA call trace. Only required when building
+ *                      with -DPSA_CALL_TRACE=1
+ *   @param           - data    : Record
+ *                    - size    : Record size in bytes
+ *   @return          - SUCCESS/FAILURE
+**/
+int pal_call_trace_write_ns(const void *data, uint32_t size);
+
+/* Hardware performance counters read by pal_perf_counters_read_ns */
+#define PAL_PERF_INSTRUCTIONS   0
+#define PAL_PERF_CYCLES         1
+#define PAL_PERF_CACHE_MISSES   2
+#define PAL_PERF_BRANCH_MISSES  3
+#define PAL_PERF_COUNTERS       4
+
+/**
+ *   @brief           - Reads the hardware performance counters of the test. Only required
+ *                      when building with -DPERF_COUNTERS
+ *   @param           - counters : PAL_PERF_COUNTERS values, indexed by PAL_PERF_*
+ *                    - valid    : Bit i set when counters[i] was read
+ *   @return          - SUCCESS, or PAL_STATUS_UNSUPPORTED_FUNC if there are no counters
+**/
+int pal_perf_counters_read_ns(uint64_t *counters, uint32_t *valid);
+
+/* Heap use of the calls of one PSA function */
+typedef struct {
+    uint32_t calls;
+    uint32_t allocations;
+    uint32_t bytes;
+    uint32_t peak_bytes;
+} pal_alloc_stats_t;
+
+/**
+ *   @brief           - Returns the heap use of the calls of a PSA function since the last
+ *                      read, and clears it. Only required when building with
+ *                      -DPSA_ALLOC_STATS=1
+ *   @param           - api     : API number of the PSA call trace, VAL_CALL_TRACE_CRYPTO
+ *                                to VAL_CALL_TRACE_ATTESTATION
+ *                    - type    : Function code
+ *                    - stats   : Calls made, blocks and bytes allocated during the calls,
+ *                                and most bytes allocated and live at once during one call
+ *   @return          - SUCCESS, or PAL_STATUS_UNSUPPORTED_FUNC if the heap is not visible
+**/
+int pal_alloc_stats_read_ns(uint32_t api, uint32_t type, pal_alloc_stats_t *stats);
+
+/**
+ *   @brief           - Returns the heap blocks allocated by PSA calls since the last read
+ *                      and still live. Only required when building with -DPSA_ALLOC_STATS=1
+ *   @param           - blocks  : Live blocks
+ *                    - bytes   : Live bytes
+ *   @return          - SUCCESS, or PAL_STATUS_UNSUPPORTED_FUNC if the heap is not visible
+**/
+int pal_alloc_leaks_read_ns(uint32_t *blocks, uint32_t *bytes);
+
 /**
  *   @brief    - Reads from given non-volatile address.
  *   @param    - base    : Base address of nvmem
@@ -20,6 +20,8 @@
 #include "val_framework.h"
 #include "val_client_defs.h"
 #include "val_attestation.h"
+#include "val_call_trace.h"
+#include "val_peripherals.h"
 
 #ifdef INITIAL_ATTESTATION
 
@@ -410,6 +412,12 @@ int32_t val_attestation_function(int type, ...)
     val_status_t status;
     uint8_t      *challenge, *token;
     size_t       challenge_size, verify_token_size;
+#ifdef PSA_CALL_TRACE
+    va_list      trace_args;
+#endif
+#ifdef FRAMEWORK_COST
+    uint32_t     cost_start = pal_timestamp_get_ns();
+#endif
 
     va_start(valist, type);
     switch (type)
@@ -423,11 +431,22 @@ int32_t val_attestation_function(int type, ...)
                                                    token, verify_token_size);
             break;
         default:
+#ifdef PSA_CALL_TRACE
+            va_copy(trace_args, valist);
+            val_call_trace_begin(VAL_CALL_TRACE_ATTESTATION, type, trace_args);
+            va_end(trace_args);
+#endif
             status = pal_attestation_function(type, valist);
+#ifdef PSA_CALL_TRACE
+            val_call_trace_end(status);
+#endif
             break;
     }
 
     va_end(valist);
+#ifdef FRAMEWORK_COST
+    val_framework_cost_add(VAL_COST_ATTESTATION, type, cost_start);
+#endif
     return status;
 #else
     (void)type;
@@ -0,0 +1,588 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_target.h"
+#include "pal_interfaces_ns.h"
+#include "val_framework.h"
+#include "val_peripherals.h"
+#include "val_call_trace.h"
+#ifdef CRYPTO
+#include "val_crypto.h"
+#endif
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE) || defined(PROTECTED_STORAGE)
+#include "val_storage.h"
+#endif
+#ifdef INITIAL_ATTESTATION
+#include "val_attestation.h"
+#endif
+
+#ifdef PSA_CALL_TRACE
+
+/* Each character of a signature is one argument, or group of arguments, as read from
+ * the va_list of the PAL dispatch function:
+ *
+ *  char  va_list arguments                  inputs recorded       outputs recorded
+ *  k     psa_key_id_t                       u32 key
+ *  K     psa_key_id_t *                                           u32 key
+ *  u     uint32_t or int                    u32 value
+ *  z     size_t                             u32 value
+ *  w     uint32_t, a size_t of the PSA API  u32 value
+ *  q     psa_storage_uid_t                  u64 uid
+ *  i     const void *, size_t               u32 length, buffer
+ *  n     uint32_t, const void *             u32 length, buffer
+ *  o     void *, size_t, size_t *           u32 size              u32 length, u32 hash
+ *  N     uint32_t, void *, size_t *         u32 size              u32 length, u32 hash
+ *  f     void *, size_t                     u32 size              u32 hash
+ *  h     operation object pointer           u32 handle
+ *  A     const psa_key_attributes_t *       attributes
+ *  a     psa_key_attributes_t *                                   u32 hash
+ *  Z     size_t *                                                 u32 value
+ *  S     struct psa_storage_info_t *        u32 size              u32 hash
+ *  x     pointer, not recorded
+ *
+ * An input buffer that is hashed has VAL_CALL_TRACE_BUF_HASHED set in its length and is
+ * followed by its u32 hash instead of its contents. Output hashes are zero when the
+ * call failed. Calls without a PSA function name are served by the PAL or by inline
+ * functions of the PSA headers, they are recorded but cannot be replayed.
+ */
+typedef struct {
+    uint8_t      api;
+    uint8_t      type;
+    uint8_t      flags;
+    const char  *name;
+    const char  *args;
+} val_call_trace_desc_t;
+
+#define REPLAY      VAL_CALL_TRACE_REPLAY
+#define COMPARE     (VAL_CALL_TRACE_REPLAY | VAL_CALL_TRACE_COMPARE)
+
+static const val_call_trace_desc_t g_call_trace_desc[] = {
+#ifdef CRYPTO
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_ABORT, COMPARE, "psa_aead_abort", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_DECRYPT, COMPARE, "psa_aead_decrypt", "kuiiio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_DECRYPT_SETUP, COMPARE, "psa_aead_decrypt_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_ENCRYPT, COMPARE, "psa_aead_encrypt", "kuiiio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_ENCRYPT_SETUP, COMPARE, "psa_aead_encrypt_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_FINISH, COMPARE, "psa_aead_finish", "hoo"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_GENERATE_NONCE, REPLAY, "psa_aead_generate_nonce", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_OPERATION_INIT, 0, "", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_SET_LENGTHS, COMPARE, "psa_aead_set_lengths", "hzz"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_SET_NONCE, COMPARE, "psa_aead_set_nonce", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_UPDATE, COMPARE, "psa_aead_update", "hio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_UPDATE_AD, COMPARE, "psa_aead_update_ad", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_AEAD_VERIFY, COMPARE, "psa_aead_verify", "hoi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_ASYMMETRIC_DECRYPT, COMPARE, "psa_asymmetric_decrypt", "kuiio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_ASYMMETRIC_ENCRYPT, REPLAY, "psa_asymmetric_encrypt", "kuiio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_ABORT, COMPARE, "psa_cipher_abort", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_DECRYPT, COMPARE, "psa_cipher_decrypt", "kuio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_DECRYPT_SETUP, COMPARE, "psa_cipher_decrypt_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_ENCRYPT, REPLAY, "psa_cipher_encrypt", "kuio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_ENCRYPT_SETUP, COMPARE, "psa_cipher_encrypt_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_FINISH, COMPARE, "psa_cipher_finish", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_GENERATE_IV, REPLAY, "psa_cipher_generate_iv", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_OPERATION_INIT, 0, "", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_SET_IV, COMPARE, "psa_cipher_set_iv", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_CIPHER_UPDATE, COMPARE, "psa_cipher_update", "hio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_COPY_KEY, COMPARE, "psa_copy_key", "kAK"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_INIT, COMPARE, "psa_crypto_init", ""},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_DESTROY_KEY, COMPARE, "psa_destroy_key", "k"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_EXPORT_KEY, COMPARE, "psa_export_key", "ko"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_EXPORT_PUBLIC_KEY, COMPARE, "psa_export_public_key", "ko"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GENERATE_KEY, REPLAY, "psa_generate_key", "AK"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GENERATE_RANDOM, REPLAY, "psa_generate_random", "f"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_ALGORITHM, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_ATTRIBUTES, REPLAY, "psa_get_key_attributes", "ka"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_BITS, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_ID, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_LIFETIME, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_TYPE, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_GET_KEY_USAGE_FLAGS, 0, "", "Ax"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_ABORT, COMPARE, "psa_hash_abort", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_CLONE, COMPARE, "psa_hash_clone", "hh"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_COMPARE, COMPARE, "psa_hash_compare", "uii"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_COMPUTE, COMPARE, "psa_hash_compute", "uio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_FINISH, COMPARE, "psa_hash_finish", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_OPERATION_INIT, 0, "", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_RESUME, COMPARE, "psa_hash_resume", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_SETUP, COMPARE, "psa_hash_setup", "hu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_SUSPEND, COMPARE, "psa_hash_suspend", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_UPDATE, COMPARE, "psa_hash_update", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_HASH_VERIFY, COMPARE, "psa_hash_verify", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_IMPORT_KEY, COMPARE, "psa_import_key", "AiK"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_ATTRIBUTES_INIT, 0, "", "x"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_ABORT, COMPARE, "psa_key_derivation_abort", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY, COMPARE,
+ "psa_key_derivation_get_capacity", "hZ"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES, COMPARE,
+ "psa_key_derivation_input_bytes", "hui"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_INPUT_KEY, COMPARE,
+ "psa_key_derivation_input_key", "huk"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT, COMPARE,
+ "psa_key_derivation_key_agreement", "huki"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_OPERATION_INIT, 0, "", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES, COMPARE,
+ "psa_key_derivation_output_bytes", "hf"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY, COMPARE,
+ "psa_key_derivation_output_key", "AhK"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY, COMPARE,
+ "psa_key_derivation_set_capacity", "hz"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_KEY_DERIVATION_SETUP, COMPARE, "psa_key_derivation_setup", "hu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_ABORT, COMPARE, "psa_mac_abort", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_COMPUTE, COMPARE, "psa_mac_compute", "kuio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_OPERATION_INIT, 0, "", "h"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_SIGN_FINISH, COMPARE, "psa_mac_sign_finish", "ho"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_SIGN_SETUP, COMPARE, "psa_mac_sign_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_UPDATE, COMPARE, "psa_mac_update", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_VERIFY, COMPARE, "psa_mac_verify", "kuii"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_VERIFY_FINISH, COMPARE, "psa_mac_verify_finish", "hi"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_MAC_VERIFY_SETUP, COMPARE, "psa_mac_verify_setup", "hku"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_PURGE_KEY, COMPARE, "psa_purge_key", "k"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_RAW_KEY_AGREEMENT, COMPARE, "psa_raw_key_agreement", "ukio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_RESET_KEY_ATTRIBUTES, 0, "", "x"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_ALGORITHM, 0, "", "xu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_BITS, 0, "", "xz"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_ID, 0, "", "xk"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_LIFETIME, 0, "", "xu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_TYPE, 0, "", "xu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SET_KEY_USAGE_FLAGS, 0, "", "xu"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SIGN_HASH, REPLAY, "psa_sign_hash", "kuio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_SIGN_MESSAGE, REPLAY, "psa_sign_message", "kuio"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_VERIFY_HASH, COMPARE, "psa_verify_hash", "kuii"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_VERIFY_MESSAGE, COMPARE, "psa_verify_message", "kuii"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_UNTRACK_KEY, 0, "", "k"},
+{VAL_CALL_TRACE_CRYPTO, VAL_CRYPTO_FREE, 0, "", ""},
+#endif
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE)
+{VAL_CALL_TRACE_ITS, VAL_ITS_SET, COMPARE, "psa_its_set", "qnu"},
+{VAL_CALL_TRACE_ITS, VAL_ITS_GET, COMPARE, "psa_its_get", "qwN"},
+{VAL_CALL_TRACE_ITS, VAL_ITS_GET_INFO, COMPARE, "psa_its_get_info", "qS"},
+{VAL_CALL_TRACE_ITS, VAL_ITS_REMOVE, COMPARE, "psa_its_remove", "q"},
+#endif
+#if defined(STORAGE) || defined(PROTECTED_STORAGE)
+{VAL_CALL_TRACE_PS, VAL_PS_SET, COMPARE, "psa_ps_set", "qnu"},
+{VAL_CALL_TRACE_PS, VAL_PS_GET, COMPARE, "psa_ps_get", "qwN"},
+{VAL_CALL_TRACE_PS, VAL_PS_GET_INFO, COMPARE, "psa_ps_get_info", "qS"},
+{VAL_CALL_TRACE_PS, VAL_PS_REMOVE, COMPARE, "psa_ps_remove", "q"},
+{VAL_CALL_TRACE_PS, VAL_PS_CREATE, COMPARE, "psa_ps_create", "qwu"},
+{VAL_CALL_TRACE_PS, VAL_PS_SET_EXTENDED, COMPARE, "psa_ps_set_extended", "qwn"},
+{VAL_CALL_TRACE_PS, VAL_PS_GET_SUPPORT, COMPARE, "psa_ps_get_support", ""},
+#endif
+#ifdef INITIAL_ATTESTATION
+{VAL_CALL_TRACE_ATTESTATION, VAL_INITIAL_ATTEST_GET_TOKEN, REPLAY,
+ "psa_initial_attest_get_token", "io"},
+{VAL_CALL_TRACE_ATTESTATION, VAL_INITIAL_ATTEST_GET_TOKEN_SIZE, COMPARE,
+ "psa_initial_attest_get_token_size", "zZ"},
+#endif
+{0, 0, 0, NULL, NULL},
+};
+
+#undef REPLAY
+#undef COMPARE
+
+/* Output arguments of the call in progress, completed by val_call_trace_end */
+typedef union {
+    uint32_t    *p_key;
+    size_t      *p_size;
+    void        *ptr;
+} val_call_trace_out_t;
+
+#define VAL_CALL_TRACE_MAX_OUTPUTS     4
+
+static struct {
+    uint32_t                     started;
+    uint32_t                     failed;
+    const val_call_trace_desc_t *desc;
+    uint32_t                     start;
+    uint32_t                     length;
+    uint32_t                     num_outputs;
+    char                         out_kind[VAL_CALL_TRACE_MAX_OUTPUTS];
+    val_call_trace_out_t         out_ptr[VAL_CALL_TRACE_MAX_OUTPUTS];
+    size_t                       out_size[VAL_CALL_TRACE_MAX_OUTPUTS];
+    size_t                      *out_length[VAL_CALL_TRACE_MAX_OUTPUTS];
+    uint8_t                      described[4][32];
+    uint8_t                      record[VAL_CALL_TRACE_RECORD_SIZE];
+} g_call_trace;
+
+/**
+    @brief    - FNV-1a hash of a buffer, the form in which outputs are recorded
+    @param    - data : buffer
+                size : buffer size
+    @return   - hash
+**/
+static uint32_t val_call_trace_hash(const void *data, size_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t       hash = 0x811C9DC5;
+
+    while ((p != NULL) && (size-- > 0))
+    {
+        hash = (hash ^ *p++) * 0x01000193;
+    }
+    return hash;
+}
+
+/**
+    @brief    - Appends bytes to the record in progress. Bytes that do not fit are dropped,
+                the callers keep within VAL_CALL_TRACE_RECORD_SIZE for fixed size fields.
+    @param    - data : bytes to append
+                size : number of bytes
+    @return   - None
+**/
+static void val_call_trace_put(const void *data, uint32_t size)
+{
+    if (g_call_trace.length + size <= VAL_CALL_TRACE_RECORD_SIZE)
+    {
+        memcpy(&g_call_trace.record[g_call_trace.length], data, size);
+        g_call_trace.length += size;
+    }
+}
+
+static void val_call_trace_put_u32(uint32_t value)
+{
+    uint8_t bytes[4];
+
+    bytes[0] = (uint8_t)value;
+    bytes[1] = (uint8_t)(value >> 8);
+    bytes[2] = (uint8_t)(value >> 16);
+    bytes[3] = (uint8_t)(value >> 24);
+    val_call_trace_put(bytes, sizeof(bytes));
+}
+
+static void val_call_trace_put_u16(uint16_t value)
+{
+    uint8_t bytes[2];
+
+    bytes[0] = (uint8_t)value;
+    bytes[1] = (uint8_t)(value >> 8);
+    val_call_trace_put(bytes, sizeof(bytes));
+}
+
+/**
+    @brief    - Appends an input buffer, or its hash if it does not fit in the record or
+                the trace hashes all buffers
+    @param    - data : buffer
+                size : buffer size
+    @return   - None
+**/
+static void val_call_trace_put_buffer(const void *data, size_t size)
+{
+    uint32_t room = VAL_CALL_TRACE_RECORD_SIZE - g_call_trace.length;
+
+#ifndef PSA_CALL_TRACE_HASH
+    /* Keep room for the outputs, at most 12 bytes each */
+    if ((data != NULL) && (size + 4 + (VAL_CALL_TRACE_MAX_OUTPUTS * 12) <= room))
+    {
+        val_call_trace_put_u32((uint32_t)size);
+        val_call_trace_put(data, (uint32_t)size);
+        return;
+    }
+#endif
+    (void)room;
+    val_call_trace_put_u32((uint32_t)size | VAL_CALL_TRACE_BUF_HASHED);
+    val_call_trace_put_u32(val_call_trace_hash(data, size));
+}
+
+/**
+    @brief    - Hands the assembled record to the PAL sink. The first failure is reported
+                and stops the recording, as a trace with missing records cannot be replayed.
+    @param    - None
+    @return   - None
+**/
+static void val_call_trace_write(void)
+{
+    if (pal_call_trace_write_ns(g_call_trace.record, g_call_trace.length) != PAL_STATUS_SUCCESS)
+    {
+        val_print(PRINT_ERROR, "\n\tPSA call trace: the target failed to store a record,"
+                               " no further calls are recorded\n", 0);
+        g_call_trace.failed = 1;
+    }
+}
+
+/**
+    @brief    - Writes the trace header, before the first record
+    @param    - None
+    @return   - None
+**/
+static void val_call_trace_start(void)
+{
+    uint16_t op_size = 0;
+
+    pal_timestamp_init_ns();
+    g_call_trace.length = 0;
+    val_call_trace_put_u32(VAL_CALL_TRACE_MAGIC);
+    val_call_trace_put_u16(VAL_CALL_TRACE_VERSION);
+#ifdef PSA_CALL_TRACE_HASH
+    val_call_trace_put_u16(VAL_CALL_TRACE_HASHED);
+#else
+    val_call_trace_put_u16(0);
+#endif
+    val_call_trace_put_u32(pal_timestamp_ticks_per_us_ns());
+#ifdef CRYPTO
+    /* The replay tool allocates each operation object with the largest size */
+    op_size = sizeof(psa_hash_operation_t);
+    op_size = (sizeof(psa_mac_operation_t) > op_size) ? sizeof(psa_mac_operation_t) : op_size;
+    op_size = (sizeof(psa_cipher_operation_t) > op_size) ?
+              sizeof(psa_cipher_operation_t) : op_size;
+    op_size = (sizeof(psa_key_derivation_operation_t) > op_size) ?
+              sizeof(psa_key_derivation_operation_t) : op_size;
+#if MISSING_CRYPTO_1_0 == 0
+    op_size = (sizeof(psa_aead_operation_t) > op_size) ? sizeof(psa_aead_operation_t) : op_size;
+#endif
+    val_call_trace_put_u16(sizeof(psa_key_attributes_t));
+#else
+    val_call_trace_put_u16(0);
+#endif
+    val_call_trace_put_u16(op_size);
+    val_call_trace_write();
+    g_call_trace.started = 1;
+}
+
+/**
+    @brief    - Writes the descriptor of a function before its first call
+    @param    - desc : function descriptor
+    @return   - None
+**/
+static void val_call_trace_describe(const val_call_trace_desc_t *desc)
+{
+    uint8_t *described = &g_call_trace.described[desc->api - 1][desc->type / 8];
+    uint8_t  byte;
+
+    if (*described & (1 << (desc->type % 8)))
+    {
+        return;
+    }
+    *described |= (uint8_t)(1 << (desc->type % 8));
+
+    g_call_trace.length = 0;
+    byte = VAL_CALL_TRACE_DESC;
+    val_call_trace_put(&byte, 1);
+    val_call_trace_put(&desc->api, 1);
+    val_call_trace_put(&desc->type, 1);
+    val_call_trace_put(&desc->flags, 1);
+    byte = (uint8_t)strlen(desc->name);
+    val_call_trace_put(&byte, 1);
+    val_call_trace_put(desc->name, byte);
+    byte = (uint8_t)strlen(desc->args);
+    val_call_trace_put(&byte, 1);
+    val_call_trace_put(desc->args, byte);
+    val_call_trace_write();
+}
+
+/**
+    @brief    - Records the inputs of a PSA call about to be dispatched to the PAL, and
+                starts timing it. Calls without a descriptor are not recorded.
+    @param    - api  : PAL dispatch function
+                type : function code
+                args : copy of the arguments of the call
+    @return   - None
+**/
+void val_call_trace_begin(val_call_trace_api_t api, int type, va_list args)
+{
+    const val_call_trace_desc_t *desc;
+    const char                  *arg;
+    const void                  *data;
+    size_t                       size;
+    uint32_t                     value, i = 0;
+    uint64_t                     uid;
+    uint8_t                      byte;
+
+    g_call_trace.desc = NULL;
+    for (desc = g_call_trace_desc; desc->name != NULL; desc++)
+    {
+        if ((desc->api == api) && (desc->type == type))
+        {
+            break;
+        }
+    }
+    if (desc->name == NULL)
+    {
+        return;
+    }
+
+    if (!g_call_trace.started)
+    {
+        val_call_trace_start();
+    }
+    if (g_call_trace.failed)
+    {
+        return;
+    }
+    val_call_trace_describe(desc);
+
+    /* Kind, api, type, pad, payload size, status and duration are filled in at the end */
+    g_call_trace.length = 16;
+    g_call_trace.num_outputs = 0;
+
+    for (arg = desc->args; *arg != '\0'; arg++)
+    {
+        i = g_call_trace.num_outputs;
+        switch (*arg)
+        {
+            case 'k':
+            case 'u':
+            case 'w':
+                val_call_trace_put_u32(va_arg(args, uint32_t));
+                break;
+            case 'z':
+                val_call_trace_put_u32((uint32_t)va_arg(args, size_t));
+                break;
+            case 'q':
+                uid = va_arg(args, uint64_t);
+                val_call_trace_put_u32((uint32_t)uid);
+                val_call_trace_put_u32((uint32_t)(uid >> 32));
+                break;
+            case 'i':
+                data = va_arg(args, const void *);
+                size = va_arg(args, size_t);
+                val_call_trace_put_buffer(data, size);
+                break;
+            case 'n':
+                value = va_arg(args, uint32_t);
+                data = va_arg(args, const void *);
+                val_call_trace_put_buffer(data, value);
+                break;
+            case 'o':
+            case 'N':
+                if (*arg == 'o')
+                {
+                    g_call_trace.out_ptr[i].ptr = va_arg(args, void *);
+                    g_call_trace.out_size[i] = va_arg(args, size_t);
+                }
+                else
+                {
+                    g_call_trace.out_size[i] = va_arg(args, uint32_t);
+                    g_call_trace.out_ptr[i].ptr = va_arg(args, void *);
+                }
+                g_call_trace.out_length[i] = va_arg(args, size_t *);
+                val_call_trace_put_u32((uint32_t)g_call_trace.out_size[i]);
+                break;
+            case 'f':
+                g_call_trace.out_ptr[i].ptr = va_arg(args, void *);
+                g_call_trace.out_size[i] = va_arg(args, size_t);
+                val_call_trace_put_u32((uint32_t)g_call_trace.out_size[i]);
+                break;
+            case 'h':
+                val_call_trace_put_u32((uint32_t)(uintptr_t)va_arg(args, void *));
+                break;
+#ifdef CRYPTO
+            case 'A':
+                data = va_arg(args, const psa_key_attributes_t *);
+                val_call_trace_put(data, sizeof(psa_key_attributes_t));
+                break;
+            case 'a':
+                g_call_trace.out_ptr[i].ptr = va_arg(args, psa_key_attributes_t *);
+                g_call_trace.out_size[i] = sizeof(psa_key_attributes_t);
+                break;
+#endif
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE) || defined(PROTECTED_STORAGE)
+            case 'S':
+                g_call_trace.out_ptr[i].ptr = va_arg(args, struct psa_storage_info_t *);
+                g_call_trace.out_size[i] = sizeof(struct psa_storage_info_t);
+                val_call_trace_put_u32((uint32_t)g_call_trace.out_size[i]);
+                break;
+#endif
+            case 'K':
+                g_call_trace.out_ptr[i].p_key = va_arg(args, uint32_t *);
+                break;
+            case 'Z':
+                g_call_trace.out_ptr[i].p_size = va_arg(args, size_t *);
+                break;
+            default:
+                (void)va_arg(args, void *);
+                break;
+        }
+
+        /* Remember the output arguments, in signature order */
+        if (strchr("oNfaSKZ", *arg) && (g_call_trace.num_outputs < VAL_CALL_TRACE_MAX_OUTPUTS))
+        {
+            g_call_trace.out_kind[g_call_trace.num_outputs++] = *arg;
+        }
+    }
+
+    byte = VAL_CALL_TRACE_CALL;
+    g_call_trace.record[0] = byte;
+    g_call_trace.record[1] = desc->api;
+    g_call_trace.record[2] = desc->type;
+    g_call_trace.record[3] = 0;
+    g_call_trace.desc = desc;
+    g_call_trace.start = pal_timestamp_get_ns();
+}
+
+/**
+    @brief    - Completes and writes the record of the call started by
+                val_call_trace_begin, with its outputs, status and duration
+    @param    - status : status returned by the PAL
+    @return   - None
+**/
+void val_call_trace_end(int32_t status)
+{
+    uint32_t    duration = pal_timestamp_elapsed_ns(g_call_trace.start, pal_timestamp_get_ns());
+    uint32_t    i, length, payload;
+    size_t      out_length;
+
+    if (g_call_trace.desc == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < g_call_trace.num_outputs; i++)
+    {
+        switch (g_call_trace.out_kind[i])
+        {
+            case 'o':
+            case 'N':
+                out_length = ((status == 0) && (g_call_trace.out_length[i] != NULL)) ?
+                             *g_call_trace.out_length[i] : 0;
+                out_length = (out_length > g_call_trace.out_size[i]) ?
+                             g_call_trace.out_size[i] : out_length;
+                val_call_trace_put_u32((uint32_t)out_length);
+                val_call_trace_put_u32((status == 0) ?
+                    val_call_trace_hash(g_call_trace.out_ptr[i].ptr, out_length) : 0);
+                break;
+            case 'f':
+            case 'a':
+            case 'S':
+                val_call_trace_put_u32((status == 0) ?
+                    val_call_trace_hash(g_call_trace.out_ptr[i].ptr, g_call_trace.out_size[i]) :
+                    0);
+                break;
+            case 'K':
+                val_call_trace_put_u32(((status == 0) && (g_call_trace.out_ptr[i].p_key != NULL))
+                                       ? *g_call_trace.out_ptr[i].p_key : 0);
+                break;
+            case 'Z':
+                val_call_trace_put_u32(((status == 0) && (g_call_trace.out_ptr[i].p_size != NULL))
+                                       ? (uint32_t)*g_call_trace.out_ptr[i].p_size : 0);
+                break;
+            default:
+                break;
+        }
+    }
+
+    /* Header fields of the call record */
+    length = g_call_trace.length;
+    payload = length - 16;
+    g_call_trace.length = 4;
+    val_call_trace_put_u32(payload);
+    val_call_trace_put_u32((uint32_t)status);
+    val_call_trace_put_u32(duration);
+    g_call_trace.length = length;
+
+    val_call_trace_write();
+    g_call_trace.desc = NULL;
+}
+#endif /* PSA_CALL_TRACE */
@@ -0,0 +1,65 @@
+/** @file
+ * Copyright (c) 2022, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_CALL_TRACE_H_
+#define _VAL_CALL_TRACE_H_
+
+#include "val.h"
+#include <stdarg.h>
+
+/* Binary PSA call trace, written through pal_call_trace_write_ns. All values are
+ * little-endian. The trace starts with a header:
+ *     u32 VAL_CALL_TRACE_MAGIC, u16 VAL_CALL_TRACE_VERSION, u16 flags,
+ *     u32 timestamp ticks per micro second, u16 key attributes size, u16 largest
+ *     operation object size
+ * followed by records, each starting with a u8 kind. The first call of each function
+ * is preceded by a descriptor of it:
+ *     u8 VAL_CALL_TRACE_DESC, u8 api, u8 type, u8 flags, u8 name length, name,
+ *     u8 signature length, signature
+ * and every call is recorded as:
+ *     u8 VAL_CALL_TRACE_CALL, u8 api, u8 type, u8 0, u32 payload size, i32 status,
+ *     u32 duration in ticks, payload
+ * The payload holds the inputs of each argument of the signature, then the outputs of
+ * each argument, as described in val_call_trace.c. tools/scripts/psa_trace.py decodes,
+ * compares and replays traces.
+ */
+#define VAL_CALL_TRACE_MAGIC           0x54415350
+#define VAL_CALL_TRACE_VERSION         1
+
+#define VAL_CALL_TRACE_DESC            1
+#define VAL_CALL_TRACE_CALL            2
+
+/* Header flags */
+#define VAL_CALL_TRACE_HASHED          0x1
+
+/* Descriptor flags */
+#define VAL_CALL_TRACE_REPLAY          0x1
+#define VAL_CALL_TRACE_COMPARE         0x2
+
+/* Input buffer length flag of a buffer recorded as a hash */
+#define VAL_CALL_TRACE_BUF_HASHED      0x80000000
+
+typedef enum {
+    VAL_CALL_TRACE_CRYPTO              = 0x1,
+    VAL_CALL_TRACE_ITS                 = 0x2,
+    VAL_CALL_TRACE_PS                  = 0x3,
+    VAL_CALL_TRACE_ATTESTATION         = 0x4,
+} val_call_trace_api_t;
+
+void val_call_trace_begin(val_call_trace_api_t api, int type, va_list args);
+void val_call_trace_end(int32_t status);
+#endif /* _VAL_CALL_TRACE_H_ */
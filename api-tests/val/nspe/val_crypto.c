@@ -20,6 +20,8 @@
 #include "val_framework.h"
 #include "val_client_defs.h"
 #include "val_crypto.h"
+#include "val_call_trace.h"
+#include "val_peripherals.h"
 
 /**
     @brief    - This API will call the requested crypto function
@@ -32,10 +34,27 @@ int32_t val_crypto_function(int type, ...)
 #ifdef CRYPTO
     va_list      valist;
     int32_t      status;
+#ifdef PSA_CALL_TRACE
+    va_list      trace_args;
+#endif
+#ifdef FRAMEWORK_COST
+    uint32_t     cost_start = pal_timestamp_get_ns();
+#endif
 
     va_start(valist, type);
+#ifdef PSA_CALL_TRACE
+    va_copy(trace_args, valist);
+    val_call_trace_begin(VAL_CALL_TRACE_CRYPTO, type, trace_args);
+    va_end(trace_args);
+#endif
     status = pal_crypto_function(type, valist);
+#ifdef PSA_CALL_TRACE
+    val_call_trace_end(status);
+#endif
     va_end(valist);
+#ifdef FRAMEWORK_COST
+    val_framework_cost_add(VAL_COST_CRYPTO, type, cost_start);
+#endif
     return status;
 #else
     (void)type;
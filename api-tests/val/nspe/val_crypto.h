@@ -152,6 +152,7 @@ enum crypto_function_code {
     VAL_CRYPTO_VERIFY_HASH,
     VAL_CRYPTO_VERIFY_MESSAGE,
     VAL_CRYPTO_RESET                            = 0xF0,
+    VAL_CRYPTO_UNTRACK_KEY                      = 0xFD,
     VAL_CRYPTO_FREE                             = 0xFE,
 };
 
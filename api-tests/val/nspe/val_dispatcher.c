@@ -73,20 +73,21 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 #include "test_entry_list.inc"
                                   {VAL_INVALID_TEST_ID, NULL}
                                   };
+#ifdef RERUN_FAILED
+    val_result_t    result;
+    val_status_t    status;
+#endif
 
     for (i = 0; i < (int)(sizeof(test_list)/sizeof(test_list[0])); i++)
     {
         if (test_id_prev == VAL_INVALID_TEST_ID)
         {
-            *test_id = test_list[i].test_id;
-            g_test_info_addr = (addr_t) test_list[i].entry_addr;
-            return VAL_STATUS_SUCCESS;
+            break;
         }
         else if (test_id_prev == test_list[i].test_id)
         {
-            *test_id = test_list[i+1].test_id;
-            g_test_info_addr = (addr_t) test_list[i+1].entry_addr;
-            return VAL_STATUS_SUCCESS;
+            i++;
+            break;
         }
         else if (test_list[i].test_id == VAL_INVALID_TEST_ID)
         {
@@ -96,9 +97,32 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
         }
     }
 
-    *test_id = VAL_INVALID_TEST_ID;
-    val_print(PRINT_ERROR, "\n\nError: No more valid tests found. Exiting.", 0);
-    return VAL_STATUS_LOAD_ERROR;
+    if (i >= (int)(sizeof(test_list)/sizeof(test_list[0])))
+    {
+        *test_id = VAL_INVALID_TEST_ID;
+        val_print(PRINT_ERROR, "\n\nError: No more valid tests found. Exiting.", 0);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+#ifdef RERUN_FAILED
+    /* Tests that passed or were skipped in the recorded run are not loaded again */
+    for (; test_list[i].test_id != VAL_INVALID_TEST_ID; i++)
+    {
+        status = val_result_map_get(test_list[i].test_id, &result);
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+        if ((result != VAL_RESULT_PASS) && (result != VAL_RESULT_SKIP))
+        {
+            break;
+        }
+    }
+#endif
+
+    *test_id = test_list[i].test_id;
+    g_test_info_addr = (addr_t) test_list[i].entry_addr;
+    return VAL_STATUS_SUCCESS;
 }
 
 /**
@@ -162,9 +186,21 @@ int32_t val_dispatcher(test_id_t test_id_prev)
     test_id_t            test_id;
     val_status_t         status;
     boot_t               boot;
-    test_count_t         test_count;
+    val_nv_state_t       nv_state;
     uint32_t             test_result;
 
+    val_nv_journal_get(&nv_state);
+#ifdef FRAMEWORK_COST
+    val_framework_cost_init();
+#endif
+#ifdef LATENCY_BUDGET
+    status = val_latency_init();
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+#endif
+
     do
     {
         status = val_get_boot_flag(&boot.state);
@@ -179,13 +215,12 @@ int32_t val_dispatcher(test_id_t test_id_prev)
         if (boot.state == BOOT_NOT_EXPECTED)
         {
             val_set_status(RESULT_PENDING(VAL_STATUS_ERROR));
-            status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
-                                    &test_id, sizeof(test_id_t));
-            if (VAL_ERROR(status))
-            {
-                val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-                return status;
-            }
+            test_id = nv_state.test_id_current;
+            val_trace_dump(test_id);
+#ifdef ADAPTIVE_WATCHDOG
+            /* The hang may be a too tight adaptive timeout, profile the test again */
+            val_wd_profile_reset(test_id);
+#endif
         }
         /* Did last run test hang and system reset due to watchdog timeout but
            boot.state was set to BOOT_EXPECTED_BUT_FAILED ? If yes, set the test status
@@ -195,13 +230,8 @@ int32_t val_dispatcher(test_id_t test_id_prev)
         else if (boot.state == BOOT_EXPECTED_BUT_FAILED)
         {
             val_set_status(RESULT_FAIL(VAL_STATUS_BOOT_EXPECTED_BUT_FAILED));
-            status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
-                                    &test_id, sizeof(test_id_t));
-            if (VAL_ERROR(status))
-            {
-                val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-                return status;
-            }
+            test_id = nv_state.test_id_current;
+            val_trace_dump(test_id);
         }
         else
         {
@@ -216,11 +246,12 @@ int32_t val_dispatcher(test_id_t test_id_prev)
                 break;
             }
 
-            status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_CURRENT),
-                                     &test_id, sizeof(test_id_t));
+            /* One journal record commits the result of the previous test together
+               with the ID of the test about to run */
+            nv_state.test_id_current = test_id;
+            status = val_nv_journal_commit(&nv_state);
             if (VAL_ERROR(status))
             {
-                val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
                 return status;
             }
 
@@ -257,67 +288,74 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
             return status;
         }
 
-        /* Prepare suite summary data structure */
-        status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
-        if (VAL_ERROR(status))
-        {
-            val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-            return status;
-        }
-
+        /* Prepare suite summary data structure, committed along with the next test ID */
         switch (test_result)
         {
             case TEST_PASS:
-                test_count.pass_cnt += 1;
+                nv_state.test_count.pass_cnt += 1;
                 break;
             case TEST_FAIL:
-                test_count.fail_cnt += 1;
+                nv_state.test_count.fail_cnt += 1;
                 break;
             case TEST_SKIP:
-                test_count.skip_cnt += 1;
+                nv_state.test_count.skip_cnt += 1;
                 break;
             case TEST_PENDING:
-                test_count.sim_error_cnt += 1;
+                nv_state.test_count.sim_error_cnt += 1;
+                break;
+            case TEST_PERF_REGRESSION:
+                nv_state.test_count.perf_regression_cnt += 1;
                 break;
         }
 
-        status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+        /* Record the outcome so that a RERUN_FAILED build can load only failed tests.
+           This is not guarded by RERUN_FAILED: the map a rerun build reads is the one
+           written by the previous full run, which is a normal build, so every build has
+           to record it. The cost is one NVMEM read and write per test. */
+        status = val_result_map_set(test_id, test_result);
         if (VAL_ERROR(status))
         {
-            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
             return status;
         }
 
+        nv_state.test_id_previous = test_id;
         test_id_prev = test_id;
-        status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS),
-                                 &test_id, sizeof(test_id_t));
-        if (VAL_ERROR(status))
-        {
-            val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
-            return status;
-        }
 
    } while(1);
 
-   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+#ifdef IPC
+   val_close_dispatcher_connections();
+#endif
+
+   /* Persist the result of the last test */
+   nv_state.test_id_current = VAL_INVALID_TEST_ID;
+   status = val_nv_journal_commit(&nv_state);
    if (VAL_ERROR(status))
    {
-       val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
        return status;
    }
 
    val_print(PRINT_ALWAYS, "\n************ ", 0);
    val_print(PRINT_ALWAYS, val_get_comp_name(test_id_prev), 0);
    val_print(PRINT_ALWAYS, " Report **********\n", 0);
-   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
-            + test_count.skip_cnt + test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", nv_state.test_count.pass_cnt
+            + nv_state.test_count.fail_cnt + nv_state.test_count.skip_cnt
+            + nv_state.test_count.sim_error_cnt + nv_state.test_count.perf_regression_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", nv_state.test_count.pass_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", nv_state.test_count.sim_error_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", nv_state.test_count.fail_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", nv_state.test_count.skip_cnt);
+#ifdef BENCHMARK
+   val_print(PRINT_ALWAYS, "TOTAL PERF REGRESSION : %d\n",
+             nv_state.test_count.perf_regression_cnt);
+#endif
    val_print(PRINT_ALWAYS, "******************************************\n", 0);
+#ifdef FRAMEWORK_COST
+   val_framework_cost_report();
+#endif
 
-   return (test_count.fail_cnt > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+   return ((nv_state.test_count.fail_cnt > 0) || (nv_state.test_count.perf_regression_cnt > 0)) ?
+          VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
 }
 
 
@@ -28,6 +28,23 @@ extern psa_api_t psa_api;
 /* globals */
 test_status_buffer_t    g_status_buffer;
 
+/* RAM copy of the dispatcher bookkeeping held in the NV_JOURNAL ring */
+static struct {
+    uint32_t       seq;
+    uint32_t       slot;
+    val_nv_state_t state;
+} g_nv_journal;
+
+#ifdef CHECKPOINT_TRACE
+/* Next sequence number and slot of the NV_TRACE ring, and the last checkpoint recorded */
+static struct {
+    uint32_t       seq;
+    uint32_t       slot;
+    test_id_t      test_id;
+    uint32_t       checkpoint;
+} g_trace;
+#endif
+
 #ifdef IPC
 /**
  * @brief Connect to given sid
@@ -184,7 +201,13 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
             }
 #endif
             /* Execute client tests */
+#ifdef PERF_COUNTERS
+            val_perf_counters_check_start();
+#endif
             test_status = tests_list[i](CALLER_NONSECURE);
+#ifdef PERF_COUNTERS
+            val_perf_counters_check_end(i);
+#endif
 #ifdef IPC
             if (server_hs == TRUE)
             {
@@ -315,6 +338,76 @@ exit:
    return status;
 }
 
+#if STATELESS_ROT != 1 && defined(PERSISTENT_DISPATCHER_CONNECTION)
+#define DISPATCHER_CONNECTION_COUNT 2
+
+typedef struct {
+    uint32_t     sid;
+    psa_handle_t handle;
+} dispatcher_connection_t;
+
+/* Client and server dispatcher connections kept open across tests */
+static dispatcher_connection_t g_dispatcher_connection[DISPATCHER_CONNECTION_COUNT];
+
+/**
+    @brief    - Returns the cached connection to the given dispatcher sid,
+                connecting on first use.
+    @param    - sid        : Partition dispatcher sid
+    @return   - Connection handle, or the psa_connect error
+**/
+static psa_handle_t val_get_dispatcher_connection(uint32_t sid)
+{
+    uint32_t     i;
+    psa_handle_t handle;
+
+    for (i = 0; i < DISPATCHER_CONNECTION_COUNT; i++)
+    {
+        if ((g_dispatcher_connection[i].handle > 0) && (g_dispatcher_connection[i].sid == sid))
+        {
+            return g_dispatcher_connection[i].handle;
+        }
+    }
+
+    handle = psa_connect(sid, 1);
+    if (handle <= 0)
+    {
+        return handle;
+    }
+
+    for (i = 0; i < DISPATCHER_CONNECTION_COUNT; i++)
+    {
+        if (g_dispatcher_connection[i].handle <= 0)
+        {
+            g_dispatcher_connection[i].sid = sid;
+            g_dispatcher_connection[i].handle = handle;
+            break;
+        }
+    }
+    return handle;
+}
+
+/**
+    @brief    - Closes a cached dispatcher connection after a failed handshake so
+                that the next test starts on a fresh connection.
+    @param    - handle     : Connection handle to be dropped
+    @return   - void
+**/
+static void val_drop_dispatcher_connection(psa_handle_t handle)
+{
+    uint32_t i;
+
+    for (i = 0; i < DISPATCHER_CONNECTION_COUNT; i++)
+    {
+        if (g_dispatcher_connection[i].handle == handle)
+        {
+            g_dispatcher_connection[i].sid = 0;
+            g_dispatcher_connection[i].handle = PSA_NULL_HANDLE;
+        }
+    }
+    psa_close(handle);
+}
+#endif
+
 /**
     @brief    - This function is used to handshake between:
                 - nonsecure client fn to server test fn
@@ -343,8 +436,12 @@ val_status_t val_execute_secure_test_func(__attribute__((unused)) psa_handle_t *
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
     }
     return status;
+#else
+#ifdef PERSISTENT_DISPATCHER_CONNECTION
+    *handle = val_get_dispatcher_connection(sid);
 #else
     *handle = psa_connect(sid, 1);
+#endif
     if (*handle > 0)
     {
         test_data = ((uint32_t)(test_info.test_num) |((uint32_t)(test_info.block_num) << BLOCK_NUM_POS)
@@ -356,7 +453,11 @@ val_status_t val_execute_secure_test_func(__attribute__((unused)) psa_handle_t *
         {
             status = VAL_STATUS_CALL_FAILED;
             val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
+#ifdef PERSISTENT_DISPATCHER_CONNECTION
+            val_drop_dispatcher_connection(*handle);
+#else
             psa_close(*handle);
+#endif
         }
     }
     else
@@ -391,12 +492,37 @@ val_status_t val_get_secure_test_result(psa_handle_t *handle)
     {
         status = VAL_STATUS_CALL_FAILED;
         val_print(PRINT_ERROR, "Call to dispatch SF failed. Status=%x\n", status_of_call);
+#if STATELESS_ROT != 1 && defined(PERSISTENT_DISPATCHER_CONNECTION)
+        val_drop_dispatcher_connection(*handle);
+#endif
     }
-#if STATELESS_ROT != 1
+#if STATELESS_ROT != 1 && !defined(PERSISTENT_DISPATCHER_CONNECTION)
     psa_close(*handle);
 #endif
     return status;
 }
+
+/**
+    @brief    - Closes the dispatcher connections kept open across tests when
+                PERSISTENT_DISPATCHER_CONNECTION is enabled. No-op otherwise.
+    @return   - void
+**/
+void val_close_dispatcher_connections(void)
+{
+#if STATELESS_ROT != 1 && defined(PERSISTENT_DISPATCHER_CONNECTION)
+    uint32_t i;
+
+    for (i = 0; i < DISPATCHER_CONNECTION_COUNT; i++)
+    {
+        if (g_dispatcher_connection[i].handle > 0)
+        {
+            psa_close(g_dispatcher_connection[i].handle);
+        }
+        g_dispatcher_connection[i].sid = 0;
+        g_dispatcher_connection[i].handle = PSA_NULL_HANDLE;
+    }
+#endif
+}
 #endif
 
 /**
@@ -439,6 +565,11 @@ uint32_t val_report_status(void)
             val_print(PRINT_ALWAYS, "\nTEST RESULT: SIM ERROR (Error Code=0x%x)\n", status);
             break;
 
+        case TEST_PERF_REGRESSION:
+            val_print(PRINT_ALWAYS, "\nTEST RESULT: PERF REGRESSION (Error Code=0x%x)\n",
+                                                    status);
+            break;
+
         default:
             state = TEST_FAIL;
             val_print(PRINT_ALWAYS, "\nTEST RESULT: FAILED(Error Code=0x%x)\n", VAL_STATUS_INVALID);
@@ -481,6 +612,8 @@ uint32_t val_get_status(void)
 
 val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status)
 {
+    val_trace_checkpoint(checkpoint);
+
     if (VAL_ERROR(status))
     {
         val_print(PRINT_ERROR, "\tCheckpoint %d : ", checkpoint);
@@ -522,6 +655,33 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
    g_status_buffer.state   = TEST_FAIL;
    g_status_buffer.status  = VAL_STATUS_INVALID;
 
+#ifdef ADAPTIVE_WATCHDOG
+   {
+       boot_t   boot;
+
+       /* Only a run without intermediate reboot covers every check of the test */
+       if (VAL_ERROR(val_get_boot_flag(&boot.state)))
+       {
+           boot.state = BOOT_UNKNOWN;
+       }
+       val_wd_profile_start(test_num, (boot.state == BOOT_NOT_EXPECTED) ? TRUE : FALSE);
+   }
+#endif
+
+#if defined(BENCHMARK) || defined(LATENCY_BUDGET)
+   /* Start the counter used by the benchmark tests and latency checks to time PSA calls */
+   val_timestamp_init();
+#endif
+#ifdef BENCHMARK
+   val_perf_start(test_num);
+#endif
+#ifdef PERF_COUNTERS
+   val_perf_counters_test_start(test_num);
+#endif
+#ifdef PSA_ALLOC_STATS
+   val_alloc_stats_test_start(test_num);
+#endif
+
    val_print(PRINT_ALWAYS, "\nTEST: %d | DESCRIPTION: ", test_num);
    val_print(PRINT_ALWAYS, desc, 0);
 
@@ -575,6 +735,15 @@ void val_test_exit(void)
     }
 #endif
 
+#ifdef PERF_COUNTERS
+    /* Reported for every test, next to its result */
+    val_perf_counters_test_end();
+#endif
+#ifdef PSA_ALLOC_STATS
+    /* After the test has freed its keys with VAL_CRYPTO_FREE */
+    val_alloc_stats_test_end();
+#endif
+
     status = val_get_status();
 
     /* return if test skipped or failed */
@@ -584,10 +753,383 @@ void val_test_exit(void)
     }
     else
     {
+#ifdef ADAPTIVE_WATCHDOG
+        val_wd_profile_commit();
+#endif
+#ifdef BENCHMARK
+        /* A test that passed but measured slower than its baseline */
+        if (val_perf_regressed() == TRUE)
+        {
+            val_set_status(RESULT_PERF_REGRESSION(VAL_STATUS_PERF_REGRESSION));
+            return;
+        }
+#endif
         val_set_status(RESULT_END(VAL_STATUS_SUCCESS));
     }
 }
 
+/**
+    @brief    - Compute the integrity word of a journal record. A record torn by a reset
+                in the middle of the NVMEM program fails this check and is ignored.
+    @param    - record : Journal record
+    @return   - uint32_t
+**/
+static uint32_t val_nv_journal_check(const val_nv_journal_record_t *record)
+{
+    uint32_t words[1 + (sizeof(val_nv_state_t) / sizeof(uint32_t))];
+    uint32_t check = VAL_NV_JOURNAL_MARKER;
+    uint32_t i;
+
+    words[0] = record->seq;
+    memcpy(&words[1], &record->state, sizeof(val_nv_state_t));
+
+    for (i = 0; i < (sizeof(words) / sizeof(words[0])); i++)
+    {
+        check = ((check << 5) | (check >> 27)) ^ words[i];
+    }
+    return check;
+}
+
+/**
+    @brief    - Rebuild the dispatcher bookkeeping from the NV_JOURNAL ring. Every record is
+                a full snapshot, so the valid record with the highest sequence number wins
+                and the ring slot after it is the next one to be programmed.
+    @param    - None
+    @return   - val_status_t
+**/
+val_status_t val_nv_journal_load(void)
+{
+    val_nv_journal_record_t records[VAL_NV_JOURNAL_RECORDS];
+    val_status_t            status;
+    int32_t                 latest = -1;
+    uint32_t                i;
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_JOURNAL), records, sizeof(records));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+        return status;
+    }
+
+    for (i = 0; i < VAL_NV_JOURNAL_RECORDS; i++)
+    {
+        if (records[i].check != val_nv_journal_check(&records[i]))
+        {
+            continue;
+        }
+        if ((latest < 0) || ((int32_t)(records[i].seq - records[latest].seq) > 0))
+        {
+            latest = (int32_t)i;
+        }
+    }
+
+    if (latest < 0)
+    {
+        g_nv_journal.seq = 0;
+        g_nv_journal.slot = 0;
+        g_nv_journal.state.test_id_previous = VAL_INVALID_TEST_ID;
+        g_nv_journal.state.test_id_current = VAL_INVALID_TEST_ID;
+        memset(&g_nv_journal.state.test_count, 0, sizeof(test_count_t));
+    }
+    else
+    {
+        g_nv_journal.seq = records[latest].seq + 1;
+        g_nv_journal.slot = ((uint32_t)latest + 1) % VAL_NV_JOURNAL_RECORDS;
+        g_nv_journal.state = records[latest].state;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Append a bookkeeping snapshot to the NV_JOURNAL ring with a single NVMEM
+                program operation. Once the ring is full the oldest record is overwritten.
+    @param    - state : Dispatcher bookkeeping to persist
+    @return   - val_status_t
+**/
+val_status_t val_nv_journal_commit(val_nv_state_t *state)
+{
+    val_nv_journal_record_t record;
+    val_status_t            status;
+
+    record.seq = g_nv_journal.seq;
+    record.state = *state;
+    record.check = val_nv_journal_check(&record);
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_JOURNAL) + (g_nv_journal.slot * sizeof(record)),
+                             &record, sizeof(record));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+        return status;
+    }
+
+    g_nv_journal.seq++;
+    g_nv_journal.slot = (g_nv_journal.slot + 1) % VAL_NV_JOURNAL_RECORDS;
+    g_nv_journal.state = *state;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Return the dispatcher bookkeeping last committed to the journal
+    @param    - state : Populated with the dispatcher bookkeeping
+    @return   - None
+**/
+void val_nv_journal_get(val_nv_state_t *state)
+{
+    *state = g_nv_journal.state;
+}
+
+/**
+    @brief    - Prepares the NV_TRACE checkpoint ring. It is cleared on first boot, on an
+                intermediate boot appending continues after the newest record.
+    @param    - first_boot : TRUE if the suite is starting from the first test
+    @return   - val_status_t
+**/
+val_status_t val_trace_init(bool_t first_boot)
+{
+#ifdef CHECKPOINT_TRACE
+    val_trace_record_t      records[VAL_TRACE_RECORDS];
+    val_status_t            status;
+    uint32_t                i;
+
+    g_trace.seq = 1;
+    g_trace.slot = 0;
+    /* No test has ID 0, the first checkpoint after a boot is always recorded */
+    g_trace.test_id = 0;
+
+    if (first_boot == TRUE)
+    {
+        memset(records, 0, sizeof(records));
+        return val_nvmem_write(VAL_NVMEM_OFFSET(NV_TRACE), records, sizeof(records));
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TRACE), records, sizeof(records));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    /* Sequence 0 marks an empty slot */
+    for (i = 0; i < VAL_TRACE_RECORDS; i++)
+    {
+        if ((records[i].seq != 0) && ((int32_t)(records[i].seq - g_trace.seq) >= 0))
+        {
+            g_trace.seq = records[i].seq + 1;
+            g_trace.slot = (i + 1) % VAL_TRACE_RECORDS;
+        }
+    }
+#else
+    (void)first_boot;
+#endif
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Appends a checkpoint of the running test to the NV_TRACE ring, so that the
+                last checkpoint reached survives a watchdog reset. This is the only place a
+                record is written. A test checking the same checkpoint through both a
+                TEST_ASSERT_* macro and val->err_check_set reaches it twice in a row, the
+                repeat is dropped rather than costing a second NVMEM write.
+    @param    - checkpoint : Checkpoint number
+    @return   - val_status_t
+**/
+val_status_t val_trace_checkpoint(uint32_t checkpoint)
+{
+#ifdef CHECKPOINT_TRACE
+    val_trace_record_t      record;
+    val_status_t            status;
+
+    if ((g_trace.test_id == g_nv_journal.state.test_id_current) && (g_trace.checkpoint == checkpoint))
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    record.seq = g_trace.seq;
+    record.test_id = g_nv_journal.state.test_id_current;
+    record.checkpoint = checkpoint;
+    record.elapsed_us = 0;
+#ifdef ADAPTIVE_WATCHDOG
+    val_wd_timer_elapsed(&record.elapsed_us);
+#endif
+
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TRACE) + (g_trace.slot * sizeof(record)),
+                             &record, sizeof(record));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    g_trace.test_id = record.test_id;
+    g_trace.checkpoint = checkpoint;
+
+    /* Skip 0, it marks an empty slot */
+    g_trace.seq = (g_trace.seq + 1) ? (g_trace.seq + 1) : 1;
+    g_trace.slot = (g_trace.slot + 1) % VAL_TRACE_RECORDS;
+#else
+    (void)checkpoint;
+#endif
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints the checkpoints recorded for a test, oldest first
+    @param    - test_id : Test ID
+    @return   - None
+**/
+void val_trace_dump(test_id_t test_id)
+{
+#ifdef CHECKPOINT_TRACE
+    val_trace_record_t      records[VAL_TRACE_RECORDS];
+    uint32_t                i, slot;
+
+    if (VAL_ERROR(val_nvmem_read(VAL_NVMEM_OFFSET(NV_TRACE), records, sizeof(records))))
+    {
+        return;
+    }
+
+    val_print(PRINT_ALWAYS, "\tCheckpoint trace of test %d before reboot:\n", test_id);
+    for (i = 0; i < VAL_TRACE_RECORDS; i++)
+    {
+        slot = (g_trace.slot + i) % VAL_TRACE_RECORDS;
+        if ((records[slot].seq == 0) || (records[slot].test_id != test_id))
+        {
+            continue;
+        }
+        val_print(PRINT_ALWAYS, "\t  Checkpoint %d", records[slot].checkpoint);
+        val_print(PRINT_ALWAYS, " at %d us\n", records[slot].elapsed_us);
+    }
+#else
+    (void)test_id;
+#endif
+}
+
+/**
+    @brief    - Prepares the NV_RESULT_MAP. A normal run starts from an empty map on first
+                boot. A RERUN_FAILED run keeps the map of the recorded run so that only its
+                failed, hung or unrun tests are loaded; without a map recorded by the same
+                suite every test is loaded.
+    @param    - first_boot : TRUE if the suite is starting from the first test
+    @return   - val_status_t
+**/
+val_status_t val_result_map_init(bool_t first_boot)
+{
+    uint32_t        map[1 + (VAL_RESULT_MAP_ENTRIES * VAL_RESULT_MAP_BITS) / 32];
+    val_status_t    status;
+
+    if (first_boot != TRUE)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+#ifdef RERUN_FAILED
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_RESULT_MAP), &map[0], sizeof(map[0]));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    if (map[0] == VAL_RESULT_MAP_ID)
+    {
+        val_print(PRINT_ALWAYS, "\nRerunning failed tests of the recorded run\n", 0);
+        return VAL_STATUS_SUCCESS;
+    }
+    val_print(PRINT_WARN, "\nNo recorded results found for this suite, running all tests\n", 0);
+#endif
+
+    memset(map, 0, sizeof(map));
+    map[0] = VAL_RESULT_MAP_ID;
+    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_RESULT_MAP), map, sizeof(map));
+    if (VAL_ERROR(status))
+    {
+        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+    }
+    return status;
+}
+
+/**
+    @brief    - Records the outcome of a test in the NV_RESULT_MAP. Tests numbered beyond
+                VAL_RESULT_MAP_ENTRIES are not recorded and read back as not run.
+    @param    - test_id     : Test ID
+                test_result : TEST_PASS, TEST_FAIL, TEST_SKIP, TEST_PENDING or
+                              TEST_PERF_REGRESSION
+    @return   - val_status_t
+**/
+val_status_t val_result_map_set(test_id_t test_id, uint32_t test_result)
+{
+    uint32_t        test_num = VAL_GET_TEST_NUM(test_id);
+    uint32_t        offset, shift, word;
+    val_result_t    result;
+    val_status_t    status;
+
+    if (test_num >= VAL_RESULT_MAP_ENTRIES)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    switch (test_result)
+    {
+        case TEST_PASS:
+            result = VAL_RESULT_PASS;
+            break;
+        case TEST_FAIL:
+            result = VAL_RESULT_FAIL;
+            break;
+        case TEST_SKIP:
+            result = VAL_RESULT_SKIP;
+            break;
+        case TEST_PERF_REGRESSION:
+            result = VAL_RESULT_PERF_REGRESSION;
+            break;
+        default:
+            result = VAL_RESULT_SIM_ERROR;
+            break;
+    }
+
+    offset = VAL_NVMEM_OFFSET(NV_RESULT_MAP + 1 + ((test_num * VAL_RESULT_MAP_BITS) / 32));
+    shift = (test_num * VAL_RESULT_MAP_BITS) % 32;
+
+    status = val_nvmem_read(offset, &word, sizeof(word));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    word &= ~((uint32_t)VAL_RESULT_MAP_MASK << shift);
+    word |= ((uint32_t)result << shift);
+    return val_nvmem_write(offset, &word, sizeof(word));
+}
+
+/**
+    @brief    - Reads the recorded outcome of a test from the NV_RESULT_MAP
+    @param    - test_id : Test ID
+                result  : Populated with the recorded outcome
+    @return   - val_status_t
+**/
+val_status_t val_result_map_get(test_id_t test_id, val_result_t *result)
+{
+    uint32_t        test_num = VAL_GET_TEST_NUM(test_id);
+    uint32_t        word;
+    val_status_t    status;
+
+    *result = VAL_RESULT_NOT_RUN;
+    if (test_num >= VAL_RESULT_MAP_ENTRIES)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_RESULT_MAP + 1
+                            + ((test_num * VAL_RESULT_MAP_BITS) / 32)), &word, sizeof(word));
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    *result = (val_result_t)((word >> ((test_num * VAL_RESULT_MAP_BITS) % 32))
+                             & VAL_RESULT_MAP_MASK);
+    return VAL_STATUS_SUCCESS;
+}
+
 /**
     @brief    - This function returns the test ID of the last test that was run
     @param    - test_id address
@@ -596,7 +1138,7 @@ void val_test_exit(void)
 val_status_t val_get_last_run_test_id(test_id_t *test_id)
 {
     val_status_t    status;
-    test_count_t    test_count;
+    val_nv_state_t  nv_state;
     boot_t          boot;
     int             i = 0, intermediate_boot = 0;
     boot_state_t    boot_state[] = {BOOT_NOT_EXPECTED,
@@ -608,6 +1150,12 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
                                     BOOT_EXPECTED_ON_SECOND_CHECK
                                     };
 
+    status = val_nv_journal_load();
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
     status = val_get_boot_flag(&boot.state);
     if (VAL_ERROR(status))
     {
@@ -634,35 +1182,44 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
              return status;
          }
 
-         *test_id = VAL_INVALID_TEST_ID;
-         status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS),
-                                  test_id, sizeof(test_id_t));
+         nv_state.test_id_previous = VAL_INVALID_TEST_ID;
+         nv_state.test_id_current = VAL_INVALID_TEST_ID;
+         nv_state.test_count.pass_cnt = 0;
+         nv_state.test_count.fail_cnt = 0;
+         nv_state.test_count.skip_cnt = 0;
+         nv_state.test_count.sim_error_cnt = 0;
+         nv_state.test_count.perf_regression_cnt = 0;
+
+         status = val_nv_journal_commit(&nv_state);
          if (VAL_ERROR(status))
          {
-             val_print(PRINT_ALWAYS, "\n\tNVMEM write error", 0);
              return status;
          }
 
-         test_count.pass_cnt = 0;
-         test_count.fail_cnt = 0;
-         test_count.skip_cnt = 0;
-         test_count.sim_error_cnt = 0;
-
-         status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT),
-                                 &test_count, sizeof(test_count_t));
+#ifdef ADAPTIVE_WATCHDOG
+         status = val_wd_profile_init();
          if (VAL_ERROR(status))
          {
-             val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
              return status;
          }
+#endif
     }
 
-    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_ID_PREVIOUS), test_id, sizeof(test_id_t));
+    status = val_trace_init(intermediate_boot ? FALSE : TRUE);
     if (VAL_ERROR(status))
     {
-        val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+        return status;
+    }
+
+    status = val_result_map_init(intermediate_boot ? FALSE : TRUE);
+    if (VAL_ERROR(status))
+    {
+        return status;
     }
 
+    val_nv_journal_get(&nv_state);
+    *test_id = nv_state.test_id_previous;
+
     val_print(PRINT_INFO, "In val_get_last_run_test_id, test_id=%x\n", *test_id);
     return status;
 }
@@ -28,6 +28,8 @@ uint32_t     val_report_status(void);
 val_status_t val_set_status(uint32_t status);
 uint32_t     val_get_status(void);
 val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status);
+val_status_t val_trace_checkpoint(uint32_t checkpoint);
+void         val_trace_dump(test_id_t test_id);
 void         val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield);
 void         val_test_exit(void);
 val_status_t val_get_last_run_test_id(test_id_t *test_id);
@@ -39,6 +41,7 @@ val_status_t val_execute_secure_test_func(psa_handle_t *handle,
                                           test_info_t test_info,
                                           uint32_t sid);
 val_status_t val_get_secure_test_result(psa_handle_t *handle);
+void         val_close_dispatcher_connections(void);
 val_status_t val_ipc_connect(uint32_t sid, uint32_t version, psa_handle_t *handle);
 val_status_t val_ipc_call(psa_handle_t handle,
                           int32_t type,
@@ -49,4 +52,11 @@ val_status_t val_ipc_call(psa_handle_t handle,
 void         val_ipc_close(psa_handle_t handle);
 val_status_t val_set_boot_flag(boot_state_t state);
 val_status_t val_get_boot_flag(boot_state_t *state);
+val_status_t val_nv_journal_load(void);
+val_status_t val_nv_journal_commit(val_nv_state_t *state);
+void         val_nv_journal_get(val_nv_state_t *state);
+val_status_t val_trace_init(bool_t first_boot);
+val_status_t val_result_map_init(bool_t first_boot);
+val_status_t val_result_map_set(test_id_t test_id, uint32_t test_result);
+val_status_t val_result_map_get(test_id_t test_id, val_result_t *result);
 #endif
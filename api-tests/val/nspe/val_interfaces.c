@@ -32,6 +32,7 @@ const val_api_t val_api = {
     .test_init                 = val_test_init,
     .test_exit                 = val_test_exit,
     .err_check_set             = val_err_check_set,
+    .trace_checkpoint          = val_trace_checkpoint,
     .target_get_config         = val_target_get_config,
     .execute_non_secure_tests  = val_execute_non_secure_tests,
 #ifdef IPC
@@ -57,6 +58,29 @@ const val_api_t val_api = {
     .wd_reprogram_timer        = val_wd_reprogram_timer,
     .set_boot_flag             = val_set_boot_flag,
     .get_boot_flag             = val_get_boot_flag,
+#if defined(BENCHMARK) || defined(LATENCY_BUDGET)
+    .timestamp_get             = val_timestamp_get,
+    .timestamp_elapsed         = val_timestamp_elapsed,
+#else
+    .timestamp_get             = NULL,
+    .timestamp_elapsed         = NULL,
+#endif
+#ifdef BENCHMARK
+    .heap_used                 = val_heap_used,
+    .perf_metric               = val_perf_metric,
+#else
+    .heap_used                 = NULL,
+    .perf_metric               = NULL,
+#endif
+#ifdef LATENCY_BUDGET
+    .latency_start             = val_latency_start,
+    .latency_end               = val_latency_end,
+    .latency_check             = val_latency_check,
+#else
+    .latency_start             = NULL,
+    .latency_end               = NULL,
+    .latency_check             = NULL,
+#endif
     .crypto_function           = val_crypto_function,
     .storage_function          = val_storage_function,
     .attestation_function      = val_attestation_function,
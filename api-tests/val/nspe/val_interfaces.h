@@ -32,6 +32,7 @@ typedef struct {
                                                    uint32_t test_bitfield);
     void             (*test_exit)                 (void);
     val_status_t     (*err_check_set)             (uint32_t checkpoint, val_status_t status);
+    val_status_t     (*trace_checkpoint)          (uint32_t checkpoint);
     val_status_t     (*target_get_config)         (cfg_id_t cfg_id, uint8_t **data, uint32_t *size);
     val_status_t     (*execute_non_secure_tests)  (uint32_t test_num,
                                                    const client_test_t *tests_list,
@@ -57,6 +58,16 @@ typedef struct {
     val_status_t     (*wd_reprogram_timer)        (wd_timeout_type_t timeout_type);
     val_status_t     (*set_boot_flag)             (boot_state_t state);
     val_status_t     (*get_boot_flag)             (boot_state_t *state);
+    uint32_t         (*timestamp_get)             (void);
+    uint32_t         (*timestamp_elapsed)         (uint32_t start, uint32_t end);
+    val_status_t     (*heap_used)                 (uint32_t *bytes);
+    val_status_t     (*perf_metric)               (const char *name, uint32_t index,
+                                                   uint32_t value, uint32_t iterations);
+    uint32_t         (*latency_start)             (void);
+    uint32_t         (*latency_end)               (uint32_t start);
+    val_status_t     (*latency_check)             (uint32_t elapsed_ns,
+                                                   val_latency_class_t latency_class,
+                                                   uint32_t checkpoint);
     int32_t          (*crypto_function)           (int type, ...);
     int32_t          (*storage_function)          (int type, ...);
     int32_t          (*attestation_function)      (int type, ...);
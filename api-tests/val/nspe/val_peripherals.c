@@ -20,10 +20,78 @@
 #include "pal_interfaces_ns.h"
 #include "val_framework.h"
 #include "val_client_defs.h"
+#include "val_call_trace.h"
 
 /* Global */
 uint32_t   is_uart_init_done = 0;
 
+#ifdef ADAPTIVE_WATCHDOG
+/* Watchdog profile of the running test */
+static struct {
+    uint32_t test_num;
+    uint32_t profile_us;
+    uint32_t max_elapsed_us;
+    bool_t   record;
+} g_wd_profile = {0, 0, 0, FALSE};
+#endif
+
+#ifdef LATENCY_BUDGET
+/* Latency budgets in micro seconds, from pal_crypto_config.h. Zero leaves the class
+   unchecked. */
+#ifndef LATENCY_BUDGET_HASH_US
+#define LATENCY_BUDGET_HASH_US                  0
+#endif
+#ifndef LATENCY_BUDGET_MAC_US
+#define LATENCY_BUDGET_MAC_US                   0
+#endif
+#ifndef LATENCY_BUDGET_CIPHER_US
+#define LATENCY_BUDGET_CIPHER_US                0
+#endif
+#ifndef LATENCY_BUDGET_AEAD_US
+#define LATENCY_BUDGET_AEAD_US                  0
+#endif
+#ifndef LATENCY_BUDGET_SIGN_US
+#define LATENCY_BUDGET_SIGN_US                  0
+#endif
+#ifndef LATENCY_BUDGET_VERIFY_US
+#define LATENCY_BUDGET_VERIFY_US                0
+#endif
+#ifndef LATENCY_BUDGET_ASYMMETRIC_ENCRYPTION_US
+#define LATENCY_BUDGET_ASYMMETRIC_ENCRYPTION_US 0
+#endif
+#ifndef LATENCY_BUDGET_KEY_AGREEMENT_US
+#define LATENCY_BUDGET_KEY_AGREEMENT_US         0
+#endif
+#ifndef LATENCY_BUDGET_KEY_DERIVATION_US
+#define LATENCY_BUDGET_KEY_DERIVATION_US        0
+#endif
+#ifndef LATENCY_BUDGET_KEY_GENERATION_US
+#define LATENCY_BUDGET_KEY_GENERATION_US        0
+#endif
+#ifndef LATENCY_BUDGET_RANDOM_US
+#define LATENCY_BUDGET_RANDOM_US                0
+#endif
+
+static const uint32_t g_latency_budget_us[VAL_LATENCY_CLASS_COUNT] = {
+    LATENCY_BUDGET_HASH_US,
+    LATENCY_BUDGET_MAC_US,
+    LATENCY_BUDGET_CIPHER_US,
+    LATENCY_BUDGET_AEAD_US,
+    LATENCY_BUDGET_SIGN_US,
+    LATENCY_BUDGET_VERIFY_US,
+    LATENCY_BUDGET_ASYMMETRIC_ENCRYPTION_US,
+    LATENCY_BUDGET_KEY_AGREEMENT_US,
+    LATENCY_BUDGET_KEY_DERIVATION_US,
+    LATENCY_BUDGET_KEY_GENERATION_US,
+    LATENCY_BUDGET_RANDOM_US,
+};
+
+static const char *const g_latency_class_name[VAL_LATENCY_CLASS_COUNT] = {
+    "hash", "mac", "cipher", "aead", "sign", "verify", "asymmetric encryption",
+    "key agreement", "key derivation", "key generation", "random",
+};
+#endif
+
 /*
     @brief    - Initialize UART.
                 This is client interface API of secure partition UART INIT API.
@@ -58,11 +126,23 @@ val_status_t val_uart_init(void)
 **/
 val_status_t val_print(print_verbosity_t verbosity, const char *string, int32_t data)
 {
+#ifdef FRAMEWORK_COST
+    uint32_t     start;
+    val_status_t status;
+#endif
+
     if ((is_uart_init_done == 0) || (verbosity < VERBOSE))
     {
        return VAL_STATUS_SUCCESS;
     }
+#ifdef FRAMEWORK_COST
+    start = pal_timestamp_get_ns();
+    status = pal_print_ns(string, data);
+    val_framework_cost_add(VAL_COST_PRINT, 0, start);
+    return status;
+#else
     return pal_print_ns(string, data);
+#endif
 }
 
 /* Watchdog APIs */
@@ -105,6 +185,23 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type)
        time_us = soc_per_desc->timeout_in_micro_sec_high;
    }
 
+#ifdef ADAPTIVE_WATCHDOG
+   /* Tighten the timeout to a margin over the longest interval seen in a passing run */
+   if (g_wd_profile.profile_us != 0)
+   {
+       uint32_t adaptive_us = g_wd_profile.profile_us * VAL_WD_ADAPTIVE_MARGIN;
+
+       if (adaptive_us < VAL_WD_ADAPTIVE_MIN_US)
+       {
+           adaptive_us = VAL_WD_ADAPTIVE_MIN_US;
+       }
+       if (adaptive_us < time_us)
+       {
+           time_us = adaptive_us;
+       }
+   }
+#endif
+
    return pal_wd_timer_init_ns(soc_per_desc->base,
                                time_us,
                                soc_per_desc->num_of_tick_per_micro_sec);
@@ -151,12 +248,28 @@ val_status_t val_wd_timer_disable(void)
         return status;
    }
 
+#ifdef ADAPTIVE_WATCHDOG
+   {
+       uint32_t elapsed_us;
+
+       /* Every disable closes an interval that started when the watchdog was armed */
+       if ((val_wd_timer_elapsed(&elapsed_us) == VAL_STATUS_SUCCESS)
+           && (elapsed_us > g_wd_profile.max_elapsed_us))
+       {
+           g_wd_profile.max_elapsed_us = elapsed_us;
+       }
+   }
+#endif
+
    return pal_wd_timer_disable_ns(soc_per_desc->base);
 }
 
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 {
     val_status_t    status = VAL_STATUS_SUCCESS;
+#ifdef FRAMEWORK_COST
+    uint32_t        start = pal_timestamp_get_ns();
+#endif
 #ifdef WATCHDOG_AVAILABLE
     /* Disable watchdog Timer */
     val_wd_timer_disable();
@@ -178,10 +291,717 @@ val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 	(void)timeout_type; // Argument unused if WATCHDOG_AVAILABLE is not defined
 #endif
 
+#ifdef FRAMEWORK_COST
+    val_framework_cost_add(VAL_COST_WATCHDOG, 0, start);
+#endif
     return status;
 }
 
 
+#ifdef ADAPTIVE_WATCHDOG
+/**
+    @brief    - Returns the time elapsed since the watchdog was last armed
+    @param    - elapsed_us : Elapsed time in micro seconds
+    @return   - error status
+**/
+val_status_t val_wd_timer_elapsed(uint32_t *elapsed_us)
+{
+   soc_peripheral_desc_t   *soc_per_desc;
+   val_status_t            status = VAL_STATUS_SUCCESS;
+
+   status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_SOC_PERIPHERAL,
+                                   SOC_PERIPHERAL_WATCHDOG, 0),
+                                   (uint8_t **)&soc_per_desc,
+                                   (uint32_t *)sizeof(soc_peripheral_desc_t));
+   if (VAL_ERROR(status))
+   {
+        return status;
+   }
+
+   if (pal_wd_timer_elapsed_ns(soc_per_desc->base,
+                               soc_per_desc->num_of_tick_per_micro_sec,
+                               elapsed_us) != 0)
+   {
+        return VAL_STATUS_ERROR;
+   }
+   return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Validates the watchdog profile table in NVMEM and clears it if it was never
+                written. Profiles recorded by an earlier run are kept.
+    @return   - error status
+**/
+val_status_t val_wd_profile_init(void)
+{
+    uint32_t        chunk[VAL_NVMEM_MAX_WRITE_SIZE / sizeof(uint32_t)];
+    uint32_t        marker, i, num;
+    val_status_t    status;
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_WD_PROFILE), &marker, sizeof(marker));
+    if (VAL_ERROR(status) || (marker == VAL_WD_PROFILE_MARKER))
+    {
+        return status;
+    }
+
+    /* The table is larger than one NVMEM write can carry, clear it a chunk at a time */
+    memset(chunk, 0, sizeof(chunk));
+    for (i = 0; i < VAL_WD_PROFILE_ENTRIES; i += num)
+    {
+        num = VAL_WD_PROFILE_ENTRIES - i;
+        if (num > (sizeof(chunk) / sizeof(chunk[0])))
+        {
+            num = sizeof(chunk) / sizeof(chunk[0]);
+        }
+        status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_WD_PROFILE + 1 + i), chunk,
+                                 num * sizeof(uint32_t));
+        if (VAL_ERROR(status))
+        {
+            return status;
+        }
+    }
+
+    /* Marker last, so that an interrupted clear is redone on the next boot */
+    marker = VAL_WD_PROFILE_MARKER;
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_WD_PROFILE), &marker, sizeof(marker));
+}
+
+/**
+    @brief    - Loads the recorded profile of a test before its watchdog is first armed
+    @param    - test_num : Test number
+                record   : Record the profile if the test passes and has none yet
+    @return   - error status
+**/
+val_status_t val_wd_profile_start(uint32_t test_num, bool_t record)
+{
+    val_status_t    status;
+
+    g_wd_profile.test_num = VAL_GET_TEST_NUM(test_num);
+    g_wd_profile.profile_us = 0;
+    g_wd_profile.max_elapsed_us = 0;
+    g_wd_profile.record = FALSE;
+
+    if (g_wd_profile.test_num >= VAL_WD_PROFILE_ENTRIES)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_WD_PROFILE + 1 + g_wd_profile.test_num),
+                            &g_wd_profile.profile_us, sizeof(uint32_t));
+    if (VAL_ERROR(status))
+    {
+        g_wd_profile.profile_us = 0;
+        return status;
+    }
+
+    g_wd_profile.record = ((record == TRUE) && (g_wd_profile.profile_us == 0)) ? TRUE : FALSE;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Stores the longest watchdog interval of a passing test as its profile
+    @return   - error status
+**/
+val_status_t val_wd_profile_commit(void)
+{
+    if ((g_wd_profile.record != TRUE) || (g_wd_profile.max_elapsed_us == 0))
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    g_wd_profile.record = FALSE;
+    val_print(PRINT_DEBUG, "\tWatchdog profile : %d us\n", g_wd_profile.max_elapsed_us);
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_WD_PROFILE + 1 + g_wd_profile.test_num),
+                           &g_wd_profile.max_elapsed_us, sizeof(uint32_t));
+}
+
+/**
+    @brief    - Drops the profile of a test that hung, so that the next run falls back to
+                the fixed timeout and profiles it again
+    @param    - test_id : Test ID
+    @return   - error status
+**/
+val_status_t val_wd_profile_reset(test_id_t test_id)
+{
+    uint32_t    profile_us = 0;
+
+    if (VAL_GET_TEST_NUM(test_id) >= VAL_WD_PROFILE_ENTRIES)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    return val_nvmem_write(VAL_NVMEM_OFFSET(NV_WD_PROFILE + 1 + VAL_GET_TEST_NUM(test_id)),
+                           &profile_us, sizeof(uint32_t));
+}
+#endif
+
+
+#if defined(BENCHMARK) || defined(LATENCY_BUDGET)
+/*
+    @brief    - Starts the free running counter used by the benchmark tests and the
+                latency budget checks
+    @param    - None
+    @return   - None
+*/
+void val_timestamp_init(void)
+{
+    pal_timestamp_init_ns();
+}
+
+/*
+    @brief    - Returns the current value of the benchmark counter, to be passed
+                to val_timestamp_elapsed
+    @param    - None
+    @return   - Counter value in ticks
+*/
+uint32_t val_timestamp_get(void)
+{
+    return pal_timestamp_get_ns();
+}
+
+/*
+    @brief    - Returns the time between two values returned by val_timestamp_get
+    @param    - start : Timestamp taken before the timed operation
+              - end   : Timestamp taken after the timed operation
+    @return   - Elapsed time in nano seconds
+*/
+uint32_t val_timestamp_elapsed(uint32_t start, uint32_t end)
+{
+    uint64_t ticks = pal_timestamp_elapsed_ns(start, end);
+
+    return (uint32_t)((ticks * 1000) / pal_timestamp_ticks_per_us_ns());
+}
+#endif
+
+#ifdef LATENCY_BUDGET
+/*
+    @brief    - Checks that every latency budget can be timed by the counter. The counter
+                wraps once per period, so a call over a longer budget could never be told
+                from one that wrapped. The period is the time elapsed from one tick to the
+                tick before it.
+    @param    - None
+    @return   - VAL_STATUS_SUCCESS, or VAL_STATUS_INVALID if a budget is too long
+*/
+val_status_t val_latency_init(void)
+{
+    uint32_t     period_us, i;
+    val_status_t status = VAL_STATUS_SUCCESS;
+
+    pal_timestamp_init_ns();
+    period_us = pal_timestamp_elapsed_ns(1, 0) / pal_timestamp_ticks_per_us_ns();
+
+    for (i = 0; i < VAL_LATENCY_CLASS_COUNT; i++)
+    {
+        if (g_latency_budget_us[i] > period_us)
+        {
+            val_print(PRINT_ERROR, "\nError: latency budget of class ", 0);
+            val_print(PRINT_ERROR, g_latency_class_name[i], 0);
+            val_print(PRINT_ERROR, " is %d us", g_latency_budget_us[i]);
+            val_print(PRINT_ERROR, ", beyond the %d us period of the timestamp counter\n",
+                      period_us);
+            status = VAL_STATUS_INVALID;
+        }
+    }
+    return status;
+}
+
+/*
+    @brief    - Takes the timestamp a latency measurement starts from, see TEST_LATENCY_START
+    @param    - None
+    @return   - Counter value in ticks
+*/
+uint32_t val_latency_start(void)
+{
+    return pal_timestamp_start_ns();
+}
+
+/*
+    @brief    - Ends a latency measurement, see TEST_LATENCY_END. The elapsed ticks only
+                hold within one counter period, so a call that may have wrapped the counter
+                beyond it is reported as ambiguous rather than under measured.
+    @param    - start : Value returned by val_latency_start
+    @return   - Duration of the call in nano seconds, or VAL_LATENCY_AMBIGUOUS
+*/
+uint32_t val_latency_end(uint32_t start)
+{
+    uint32_t end = pal_timestamp_get_ns();
+
+    if (pal_timestamp_wrapped_ns())
+    {
+        return VAL_LATENCY_AMBIGUOUS;
+    }
+    return val_timestamp_elapsed(start, end);
+}
+
+/*
+    @brief    - Prints the measured duration of a call over budget
+    @param    - verbosity  : Print verbosity level
+              - elapsed_ns : Duration of the call, or VAL_LATENCY_AMBIGUOUS
+    @return   - None
+*/
+static void val_latency_print_actual(print_verbosity_t verbosity, uint32_t elapsed_ns)
+{
+    if (elapsed_ns == VAL_LATENCY_AMBIGUOUS)
+    {
+        val_print(verbosity, "\n\tActual: beyond the timestamp counter period\n", 0);
+    }
+    else
+    {
+        val_print(verbosity, "\n\tActual: %d us\n", elapsed_ns / 1000);
+    }
+}
+
+/*
+    @brief    - Checks the duration of a call against the latency budget of an API class.
+                A call over budget fails the test in a -DLATENCY_BUDGET=FAIL build, and is
+                only reported in a -DLATENCY_BUDGET=WARN build.
+    @param    - elapsed_ns    : Duration of the call, as measured by TEST_LATENCY_START
+                                and TEST_LATENCY_END. VAL_LATENCY_AMBIGUOUS is over
+                                any budget.
+              - latency_class : API class of the timed call
+              - checkpoint    : Checkpoint of the check, for the report
+    @return   - VAL_STATUS_SUCCESS, or VAL_STATUS_LATENCY_EXCEEDED
+*/
+val_status_t val_latency_check(uint32_t elapsed_ns, val_latency_class_t latency_class,
+                               uint32_t checkpoint)
+{
+    uint32_t elapsed_us = elapsed_ns / 1000;
+    uint32_t budget_us;
+
+    if (latency_class >= VAL_LATENCY_CLASS_COUNT)
+    {
+        return VAL_STATUS_INVALID;
+    }
+
+    budget_us = g_latency_budget_us[latency_class];
+    if ((budget_us == 0) || ((elapsed_ns != VAL_LATENCY_AMBIGUOUS) && (elapsed_us <= budget_us)))
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+#ifdef LATENCY_BUDGET_FAIL
+    val_print(PRINT_ERROR, "\tLatency budget exceeded at Checkpoint: %d\n", checkpoint);
+    val_print(PRINT_ERROR, "\tClass: ", 0);
+    val_print(PRINT_ERROR, g_latency_class_name[latency_class], 0);
+    val_latency_print_actual(PRINT_ERROR, elapsed_ns);
+    val_print(PRINT_ERROR, "\tBudget: %d us\n", budget_us);
+    return VAL_STATUS_LATENCY_EXCEEDED;
+#else
+    val_print(PRINT_WARN, "\tWarning: latency budget exceeded at Checkpoint: %d\n", checkpoint);
+    val_print(PRINT_WARN, "\tClass: ", 0);
+    val_print(PRINT_WARN, g_latency_class_name[latency_class], 0);
+    val_latency_print_actual(PRINT_WARN, elapsed_ns);
+    val_print(PRINT_WARN, "\tBudget: %d us\n", budget_us);
+    return VAL_STATUS_SUCCESS;
+#endif
+}
+#endif
+
+#ifdef BENCHMARK
+
+/*
+    @brief    - Returns the heap usage of the implementation under test
+    @param    - bytes : Heap bytes in use
+    @return   - VAL_STATUS_SUCCESS, or VAL_STATUS_UNSUPPORTED if the target cannot tell
+*/
+val_status_t val_heap_used(uint32_t *bytes)
+{
+    if (pal_heap_used_ns(bytes) != 0)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+#ifdef BENCHMARK_BASELINE
+/* Metric of a baseline run, as saved by tools/scripts/perf_baseline.py */
+typedef struct {
+    uint32_t    test_num;
+    const char  *name;
+    uint32_t    index;
+    uint32_t    value;
+} val_perf_baseline_t;
+
+static const val_perf_baseline_t g_perf_baseline[] = {
+#include "perf_baseline.inc"
+    {0, NULL, 0, 0}
+};
+#endif
+
+static uint32_t g_perf_test_num;
+static bool_t   g_perf_regressed = FALSE;
+
+/*
+    @brief    - Starts the metric collection of a test
+    @param    - test_num : Test number, the key of the test metrics in the baseline
+    @return   - None
+*/
+void val_perf_start(uint32_t test_num)
+{
+    g_perf_test_num  = test_num;
+    g_perf_regressed = FALSE;
+}
+
+/*
+    @brief    - Returns whether a metric of the current test exceeded its baseline
+    @param    - None
+    @return   - TRUE if the test regressed
+*/
+bool_t val_perf_regressed(void)
+{
+    return g_perf_regressed;
+}
+
+/*
+    @brief    - Reports a benchmark metric, lower is better. The metric is printed on a
+                PERF line that tools/scripts/perf_baseline.py collects into a baseline.
+                In a build with a baseline, a metric timed over at least
+                BENCHMARK_MIN_ITERATIONS iterations that exceeds its baseline value by
+                more than BENCHMARK_THRESHOLD percent marks the test as regressed.
+    @param    - name       : Metric name, unique within the test
+              - index      : Row of the metric when a test reports it more than once
+              - value      : Measured value, usually a mean time in nano seconds
+              - iterations : Number of timed iterations behind the value
+    @return   - VAL_STATUS_SUCCESS, or VAL_STATUS_PERF_REGRESSION
+*/
+val_status_t val_perf_metric(const char *name, uint32_t index, uint32_t value,
+                             uint32_t iterations)
+{
+#ifdef BENCHMARK_BASELINE
+    uint32_t i;
+#endif
+
+    val_print(PRINT_ALWAYS, "\tPERF|%d|", g_perf_test_num);
+    val_print(PRINT_ALWAYS, name, 0);
+    val_print(PRINT_ALWAYS, "|%d|", index);
+    val_print(PRINT_ALWAYS, "%d|", value);
+    val_print(PRINT_ALWAYS, "%d\n", iterations);
+
+#ifdef BENCHMARK_BASELINE
+    if (iterations < BENCHMARK_MIN_ITERATIONS)
+    {
+        return VAL_STATUS_SUCCESS;
+    }
+
+    for (i = 0; g_perf_baseline[i].name != NULL; i++)
+    {
+        if ((g_perf_baseline[i].test_num != g_perf_test_num)
+            || (g_perf_baseline[i].index != index)
+            || (strcmp(g_perf_baseline[i].name, name) != 0))
+        {
+            continue;
+        }
+
+        if ((uint64_t)value * 100 >
+            (uint64_t)g_perf_baseline[i].value * (100 + BENCHMARK_THRESHOLD))
+        {
+            val_print(PRINT_ERROR, "\tPERF REGRESSION: ", 0);
+            val_print(PRINT_ERROR, name, 0);
+            val_print(PRINT_ERROR, " is %d percent of the baseline\n",
+                      (int32_t)(((uint64_t)value * 100) / (g_perf_baseline[i].value ?
+                                                           g_perf_baseline[i].value : 1)));
+            g_perf_regressed = TRUE;
+            return VAL_STATUS_PERF_REGRESSION;
+        }
+        break;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
+#endif
+
+#ifdef PERF_COUNTERS
+/* Counters at the start of the running test and of its running check */
+typedef struct {
+    uint64_t value[PAL_PERF_COUNTERS];
+    uint32_t valid;
+} val_perf_counters_t;
+
+static val_perf_counters_t g_perf_counters_test;
+static val_perf_counters_t g_perf_counters_check;
+static uint32_t            g_perf_counters_test_num;
+
+/*
+    @brief    - Prints an unsigned 64 bit value in decimal, which val_print cannot format
+    @param    - value : Value to print
+    @return   - None
+*/
+static void val_print_u64(uint64_t value)
+{
+    char     digits[21];
+    uint32_t i = sizeof(digits) - 1;
+
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    val_print(PRINT_ALWAYS, &digits[i], 0);
+}
+
+/*
+    @brief    - Prints the counters accumulated since a sample, on a line
+                COUNTERS|<test>|<check>|<instructions>|<cycles>|<cache misses>|<branch misses>
+                with check 0 for the whole test, and - for a counter that was not read
+    @param    - start : Sample taken at the start of the test or check
+              - check : Check number, 0 for the whole test
+    @return   - None
+*/
+static void val_perf_counters_report(const val_perf_counters_t *start, uint32_t check)
+{
+    val_perf_counters_t now;
+    uint32_t            i;
+
+    if (pal_perf_counters_read_ns(now.value, &now.valid) != 0)
+    {
+        return;
+    }
+
+    val_print(PRINT_ALWAYS, "\tCOUNTERS|%d|", g_perf_counters_test_num);
+    val_print(PRINT_ALWAYS, "%d", check);
+    for (i = 0; i < PAL_PERF_COUNTERS; i++)
+    {
+        val_print(PRINT_ALWAYS, "|", 0);
+        if ((now.valid & start->valid) & (1U << i))
+        {
+            val_print_u64(now.value[i] - start->value[i]);
+        }
+        else
+        {
+            val_print(PRINT_ALWAYS, "-", 0);
+        }
+    }
+    val_print(PRINT_ALWAYS, "\n", 0);
+}
+
+/*
+    @brief    - Starts counting the hardware events of a test
+    @param    - test_num : Test number, reported with the counters
+    @return   - None
+*/
+void val_perf_counters_test_start(uint32_t test_num)
+{
+    g_perf_counters_test_num = test_num;
+    if (pal_perf_counters_read_ns(g_perf_counters_test.value, &g_perf_counters_test.valid) != 0)
+    {
+        g_perf_counters_test.valid = 0;
+    }
+}
+
+/*
+    @brief    - Reports the hardware events counted over the whole test
+    @param    - None
+    @return   - None
+*/
+void val_perf_counters_test_end(void)
+{
+    val_perf_counters_report(&g_perf_counters_test, 0);
+}
+
+/*
+    @brief    - Starts counting the hardware events of a check of the running test
+    @param    - None
+    @return   - None
+*/
+void val_perf_counters_check_start(void)
+{
+    if (pal_perf_counters_read_ns(g_perf_counters_check.value, &g_perf_counters_check.valid) != 0)
+    {
+        g_perf_counters_check.valid = 0;
+    }
+}
+
+/*
+    @brief    - Reports the hardware events counted over a check of the running test
+    @param    - check : Check number, the index of the check in the test list
+    @return   - None
+*/
+void val_perf_counters_check_end(uint32_t check)
+{
+    val_perf_counters_report(&g_perf_counters_check, check);
+}
+#endif
+
+#ifdef FRAMEWORK_COST
+/* Function codes of a dispatch API run up to VAL_CRYPTO_FREE */
+#define VAL_COST_TYPES      0x100
+
+/* Back to back timestamps taken to measure the cost of the timestamp itself */
+#define VAL_COST_TIMER_SAMPLES  16
+
+typedef struct {
+    uint32_t calls;
+    uint32_t min_ticks;
+    uint64_t ticks;
+} val_cost_t;
+
+static struct {
+    uint32_t   started;
+    uint32_t   timer_ticks;
+    val_cost_t cost[VAL_COST_OP_COUNT][VAL_COST_TYPES];
+} g_framework_cost;
+
+/*
+    @brief    - Starts timing the framework. Operations ended before are not counted.
+    @param    - None
+    @return   - None
+*/
+void val_framework_cost_init(void)
+{
+    uint32_t start, ticks, i;
+
+    pal_timestamp_init_ns();
+    g_framework_cost.timer_ticks = 0xFFFFFFFF;
+    for (i = 0; i < VAL_COST_TIMER_SAMPLES; i++)
+    {
+        start = pal_timestamp_get_ns();
+        ticks = pal_timestamp_elapsed_ns(start, pal_timestamp_get_ns());
+        if (ticks < g_framework_cost.timer_ticks)
+        {
+            g_framework_cost.timer_ticks = ticks;
+        }
+    }
+    g_framework_cost.started = 1;
+}
+
+/*
+    @brief    - Counts a framework operation, less the cost of the timestamps taken
+    @param    - op    : Operation
+              - type  : Function code of a dispatch operation, 0 otherwise
+              - start : pal_timestamp_get_ns value taken when the operation started
+    @return   - None
+*/
+void val_framework_cost_add(val_cost_op_t op, int type, uint32_t start)
+{
+    uint32_t    ticks = pal_timestamp_elapsed_ns(start, pal_timestamp_get_ns());
+    val_cost_t *cost;
+
+    if (!g_framework_cost.started || (op >= VAL_COST_OP_COUNT) ||
+        ((uint32_t)type >= VAL_COST_TYPES))
+    {
+        return;
+    }
+
+    ticks = (ticks > g_framework_cost.timer_ticks) ? ticks - g_framework_cost.timer_ticks : 0;
+    cost = &g_framework_cost.cost[op][type];
+    if ((cost->calls == 0) || (ticks < cost->min_ticks))
+    {
+        cost->min_ticks = ticks;
+    }
+    cost->calls++;
+    cost->ticks += ticks;
+}
+
+/*
+    @brief    - Prints the cost of each framework operation timed since
+                val_framework_cost_init, on lines
+                OVERHEAD|<op>|<function code>|<calls>|<mean ns>|<min ns>
+                with op a val_cost_op_t value. The prints of the report are not counted.
+    @param    - None
+    @return   - None
+*/
+void val_framework_cost_report(void)
+{
+    uint32_t          ticks_per_us = pal_timestamp_ticks_per_us_ns();
+    const val_cost_t *cost;
+    uint32_t          op, type;
+
+    g_framework_cost.started = 0;
+    val_print(PRINT_ALWAYS, "\nFramework cost per call, timer cost of %d ns excluded\n",
+              (int32_t)(((uint64_t)g_framework_cost.timer_ticks * 1000) / ticks_per_us));
+    for (op = VAL_COST_CRYPTO; op < VAL_COST_OP_COUNT; op++)
+    {
+        for (type = 0; type < VAL_COST_TYPES; type++)
+        {
+            cost = &g_framework_cost.cost[op][type];
+            if (cost->calls == 0)
+            {
+                continue;
+            }
+            val_print(PRINT_ALWAYS, "OVERHEAD|%d|", op);
+            val_print(PRINT_ALWAYS, "%d|", type);
+            val_print(PRINT_ALWAYS, "%d|", cost->calls);
+            val_print(PRINT_ALWAYS, "%d|", (int32_t)((cost->ticks * 1000) /
+                                                      ((uint64_t)ticks_per_us * cost->calls)));
+            val_print(PRINT_ALWAYS, "%d\n", (int32_t)(((uint64_t)cost->min_ticks * 1000) /
+                                                        ticks_per_us));
+        }
+    }
+}
+#endif
+
+#ifdef PSA_ALLOC_STATS
+/* Function codes of a dispatch API run up to VAL_CRYPTO_FREE */
+#define VAL_ALLOC_TYPES     0x100
+
+static uint32_t g_alloc_test_num;
+
+/*
+    @brief    - Starts counting the heap use of the PSA calls of a test
+    @param    - test_num : Test number, reported with the heap use
+    @return   - None
+*/
+void val_alloc_stats_test_start(uint32_t test_num)
+{
+    pal_alloc_stats_t stats;
+    uint32_t          api, type, blocks, bytes;
+
+    g_alloc_test_num = test_num;
+    for (api = VAL_CALL_TRACE_CRYPTO; api <= VAL_CALL_TRACE_ATTESTATION; api++)
+    {
+        for (type = 0; type < VAL_ALLOC_TYPES; type++)
+        {
+            pal_alloc_stats_read_ns(api, type, &stats);
+        }
+    }
+    pal_alloc_leaks_read_ns(&blocks, &bytes);
+}
+
+/*
+    @brief    - Reports the heap use of the PSA calls of a test. Each function that
+                allocated is reported on a line
+                ALLOC|<test>|<api>|<function code>|<calls>|<allocations>|<bytes>|<peak bytes>
+                followed by the blocks the calls left allocated on a line
+                LEAK|<test>|<blocks>|<bytes>
+    @param    - None
+    @return   - None
+*/
+void val_alloc_stats_test_end(void)
+{
+    pal_alloc_stats_t stats;
+    uint32_t          api, type, blocks, bytes;
+
+    for (api = VAL_CALL_TRACE_CRYPTO; api <= VAL_CALL_TRACE_ATTESTATION; api++)
+    {
+        for (type = 0; type < VAL_ALLOC_TYPES; type++)
+        {
+            if ((pal_alloc_stats_read_ns(api, type, &stats) != 0) || (stats.allocations == 0))
+            {
+                continue;
+            }
+            val_print(PRINT_ALWAYS, "\tALLOC|%d|", g_alloc_test_num);
+            val_print(PRINT_ALWAYS, "%d|", api);
+            val_print(PRINT_ALWAYS, "%d|", type);
+            val_print(PRINT_ALWAYS, "%d|", stats.calls);
+            val_print(PRINT_ALWAYS, "%d|", stats.allocations);
+            val_print(PRINT_ALWAYS, "%d|", stats.bytes);
+            val_print(PRINT_ALWAYS, "%d\n", stats.peak_bytes);
+        }
+    }
+
+    if (pal_alloc_leaks_read_ns(&blocks, &bytes) != 0)
+    {
+        return;
+    }
+    val_print(PRINT_ALWAYS, "\tLEAK|%d|", g_alloc_test_num);
+    val_print(PRINT_ALWAYS, "%d|", blocks);
+    val_print(PRINT_ALWAYS, "%d\n", bytes);
+}
+#endif
+
 /*
     @brief     - Reads 'size' bytes from Non-volatile memory at a given. This is client interface
                 API of secure partition val_nvmem_read_sf API for nspe world.
@@ -28,4 +28,45 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type);
 val_status_t val_wd_timer_enable(void);
 val_status_t val_wd_timer_disable(void);
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type);
+#ifdef ADAPTIVE_WATCHDOG
+val_status_t val_wd_timer_elapsed(uint32_t *elapsed_us);
+val_status_t val_wd_profile_init(void);
+val_status_t val_wd_profile_start(uint32_t test_num, bool_t record);
+val_status_t val_wd_profile_commit(void);
+val_status_t val_wd_profile_reset(test_id_t test_id);
+#endif
+#if defined(BENCHMARK) || defined(LATENCY_BUDGET)
+void val_timestamp_init(void);
+uint32_t val_timestamp_get(void);
+uint32_t val_timestamp_elapsed(uint32_t start, uint32_t end);
+#endif
+#ifdef LATENCY_BUDGET
+val_status_t val_latency_init(void);
+uint32_t val_latency_start(void);
+uint32_t val_latency_end(uint32_t start);
+val_status_t val_latency_check(uint32_t elapsed_ns, val_latency_class_t latency_class,
+                               uint32_t checkpoint);
+#endif
+#ifdef BENCHMARK
+val_status_t val_heap_used(uint32_t *bytes);
+void val_perf_start(uint32_t test_num);
+bool_t val_perf_regressed(void);
+val_status_t val_perf_metric(const char *name, uint32_t index, uint32_t value,
+                             uint32_t iterations);
+#endif
+#ifdef PERF_COUNTERS
+void val_perf_counters_test_start(uint32_t test_num);
+void val_perf_counters_test_end(void);
+void val_perf_counters_check_start(void);
+void val_perf_counters_check_end(uint32_t check);
+#endif
+#ifdef FRAMEWORK_COST
+void val_framework_cost_init(void);
+void val_framework_cost_add(val_cost_op_t op, int type, uint32_t start);
+void val_framework_cost_report(void);
+#endif
+#ifdef PSA_ALLOC_STATS
+void val_alloc_stats_test_start(uint32_t test_num);
+void val_alloc_stats_test_end(void);
+#endif
 #endif
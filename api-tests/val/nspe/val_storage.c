@@ -21,6 +21,7 @@
 #include "val_client_defs.h"
 #include "val_peripherals.h"
 #include "val_storage.h"
+#include "val_call_trace.h"
 
 /**
     @brief    - This API will call the requested internal trusted storage function
@@ -33,6 +34,12 @@ int32_t val_storage_function(int type, ...)
 #if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE) || defined(PROTECTED_STORAGE)
     va_list valist;
     int32_t status;
+#ifdef PSA_CALL_TRACE
+    va_list trace_args;
+#endif
+#ifdef FRAMEWORK_COST
+    uint32_t cost_start = pal_timestamp_get_ns();
+#endif
 
     va_start(valist, type);
     switch (type)
@@ -42,7 +49,15 @@ int32_t val_storage_function(int type, ...)
         case VAL_ITS_GET:
         case VAL_ITS_GET_INFO:
         case VAL_ITS_REMOVE:
+#ifdef PSA_CALL_TRACE
+            va_copy(trace_args, valist);
+            val_call_trace_begin(VAL_CALL_TRACE_ITS, type, trace_args);
+            va_end(trace_args);
+#endif
             status = pal_its_function(type, valist);
+#ifdef PSA_CALL_TRACE
+            val_call_trace_end(status);
+#endif
             break;
 #endif
 #if defined(STORAGE) || defined(PROTECTED_STORAGE)
@@ -53,7 +68,15 @@ int32_t val_storage_function(int type, ...)
         case VAL_PS_CREATE:
         case VAL_PS_SET_EXTENDED:
         case VAL_PS_GET_SUPPORT:
+#ifdef PSA_CALL_TRACE
+            va_copy(trace_args, valist);
+            val_call_trace_begin(VAL_CALL_TRACE_PS, type, trace_args);
+            va_end(trace_args);
+#endif
             status = pal_ps_function(type, valist);
+#ifdef PSA_CALL_TRACE
+            val_call_trace_end(status);
+#endif
             break;
 #endif
         default:
@@ -61,6 +84,9 @@ int32_t val_storage_function(int type, ...)
             return VAL_STATUS_ERROR;
     }
     va_end(valist);
+#ifdef FRAMEWORK_COST
+    val_framework_cost_add((type < VAL_PS_SET) ? VAL_COST_ITS : VAL_COST_PS, type, cost_start);
+#endif
     return status;
 #else
     (void)type;
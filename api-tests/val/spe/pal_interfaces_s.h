@@ -105,4 +105,34 @@ void pal_generate_interrupt(void);
     @return  - void
 **/
 void pal_disable_interrupt(void);
+
+/**
+    @brief   - Starts the free running counter used to timestamp driver partition events
+    @param   - void
+    @return  - void
+**/
+void pal_timestamp_init(void);
+
+/**
+    @brief   - Returns the current value of the free running counter
+    @param   - void
+    @return  - counter value in ticks
+**/
+uint32_t pal_timestamp_get(void);
+
+/**
+    @brief   - Returns the number of ticks between two values returned by pal_timestamp_get,
+               accounting for counter wrap
+    @param   - start   : timestamp taken first
+               end     : timestamp taken last
+    @return  - elapsed ticks
+**/
+uint32_t pal_timestamp_elapsed(uint32_t start, uint32_t end);
+
+/**
+    @brief   - Returns the number of counter ticks per micro second
+    @param   - void
+    @return  - ticks per micro second
+**/
+uint32_t pal_timestamp_ticks_per_us(void);
 #endif
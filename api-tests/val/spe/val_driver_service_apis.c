@@ -243,3 +243,44 @@ void val_disable_interrupt(void)
 {
     pal_disable_interrupt();
 }
+
+/**
+    @brief   - Starts the free running counter used to timestamp driver partition events
+    @param   - void
+    @return  - void
+**/
+void val_timestamp_init_sf(void)
+{
+    pal_timestamp_init();
+}
+
+/**
+    @brief   - Returns the current value of the free running counter
+    @param   - void
+    @return  - counter value in ticks
+**/
+uint32_t val_timestamp_get_sf(void)
+{
+    return pal_timestamp_get();
+}
+
+/**
+    @brief   - Returns the number of ticks between two values returned by val_timestamp_get_sf
+    @param   - start   : timestamp taken first
+               end     : timestamp taken last
+    @return  - elapsed ticks
+**/
+uint32_t val_timestamp_elapsed_sf(uint32_t start, uint32_t end)
+{
+    return pal_timestamp_elapsed(start, end);
+}
+
+/**
+    @brief   - Returns the number of counter ticks per micro second
+    @param   - void
+    @return  - ticks per micro second
+**/
+uint32_t val_timestamp_ticks_per_us_sf(void)
+{
+    return pal_timestamp_ticks_per_us();
+}
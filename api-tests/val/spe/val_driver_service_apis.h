@@ -38,4 +38,8 @@ val_status_t val_init_driver_memory(void);
 val_status_t val_get_driver_mmio_addr(addr_t *base_addr);
 void val_generate_interrupt(void);
 void val_disable_interrupt(void);
+void val_timestamp_init_sf(void);
+uint32_t val_timestamp_get_sf(void);
+uint32_t val_timestamp_elapsed_sf(uint32_t start, uint32_t end);
+uint32_t val_timestamp_ticks_per_us_sf(void);
 #endif
@@ -26,6 +26,7 @@ list(APPEND VAL_SRC_C_NSPE
 	${PSA_ROOT_DIR}/val/common/val_target.c
 	${PSA_ROOT_DIR}/val/nspe/val_attestation.c
 	${PSA_ROOT_DIR}/val/nspe/val_storage.c
+	${PSA_ROOT_DIR}/val/nspe/val_call_trace.c
 )
 
 # Create VAL NSPE library
@@ -56,4 +57,10 @@ target_include_directories(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE
 if(${WATCHDOG_AVAILABLE} EQUAL 1)
 	target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE WATCHDOG_AVAILABLE)
 endif()
+if(${ADAPTIVE_WATCHDOG} EQUAL 1)
+	target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE ADAPTIVE_WATCHDOG)
+endif()
+if(${RERUN_FAILED} EQUAL 1)
+	target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE RERUN_FAILED)
+endif()
 target_compile_definitions(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE VAL_NSPE_BUILD)
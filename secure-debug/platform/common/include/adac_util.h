@@ -20,6 +20,9 @@
 #include <psa_adac.h>
 
 #define PSA_LIFECYCLE_MAJOR_STATE 0xFF00u
+
+/* Maximum number of commands sent to the target ahead of their responses */
+#define ADAC_MAX_INFLIGHT_COMMANDS 4
 /** \brief Token header
  *
  */
@@ -84,22 +87,23 @@ psa_status_t psa_adac_check_cryptosystem_support(response_packet_t *packet, uint
 request_packet_t *request_packet_lock(size_t *max_data_size);
 
 /**
- *   @brief    - Reserve the communication buffer memory for receive packet.
+ *   @brief    - Reserve a free packet of the message pool for receive. Several packets
+ *               may be held at the same time, up to ADAC_PACKET_POOL_SIZE.
  *   @param    - max_data_size      Valid size of command frame
- *   @return   - Pointer to the command frame to be read
+ *   @return   - Pointer to the command frame to be read, NULL if the pool is exhausted
 **/
 response_packet_t *response_packet_lock(size_t *max_data_size);
 
 /**
- *   @brief    - Release the lock held by transmit packet.
- *   @param    - packet      Most recent command frame sent
+ *   @brief    - Return a transmit packet to the message pool.
+ *   @param    - packet      Command frame obtained from request_packet_lock/build
  *   @return   - SUCCESS/FAILURE
 **/
 int request_packet_release(request_packet_t *packet);
 
 /**
- *   @brief    - Release the lock held by receive packet.
- *   @param    - packet      Most recent response packet received
+ *   @brief    - Return a receive packet to the message pool.
+ *   @param    - packet      Response packet obtained from response_packet_lock/receive
  *   @return   - SUCCESS/FAILURE
 **/
 int response_packet_release(response_packet_t *packet);
@@ -120,6 +124,18 @@ request_packet_t *request_packet_build(uint16_t command, uint8_t *data, size_t d
 **/
 int request_packet_send(request_packet_t *packet);
 
+/**
+ *   @brief    - Send several Request packets for the same ADAC command back to back, without
+ *               waiting for the responses in between. The payloads are sent in place.
+ *   @param    - command      ADAC command
+ *               data         Array of payload pointers, one per request
+ *               data_size    Array of payload sizes, one per request
+ *               count        Number of requests, at most ADAC_MAX_INFLIGHT_COMMANDS
+ *   @return   - SUCCESS/FAILURE
+**/
+int request_packet_send_batch(uint16_t command, uint8_t *data[], size_t data_size[],
+                              size_t count);
+
 /**
  *   @brief    - Read the Response packet from the communication buffer.
  *   @param    - None
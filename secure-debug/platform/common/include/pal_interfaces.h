@@ -18,8 +18,26 @@
 #define _PAL_INTERFACES_H_
 
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/* Returned by PAL functions that the host platform does not implement */
+#define PAL_STATUS_UNSUPPORTED_FUNC      0xFF
+
+/* Number of packets the message buffer given to msg_interface_init is split into */
+#define ADAC_PACKET_POOL_SIZE            4
+
+/* Size of a single packet in the message buffer */
+#define ADAC_PACKET_SIZE                 4096
+
+/** \brief Element of a gathered transmit
+ *
+ */
+typedef struct {
+    const uint8_t *base;
+    size_t size;
+} pal_msg_vector_t;
+
 /**
  *   @brief    - This function parses the input string and writes bytes into logger TX FIFO
  *   @param    - str      : Input String
@@ -46,6 +64,8 @@ int pal_system_reset(void);
 
 /**
  *   @brief    - Initialise the host-side channel for communication with device.
+ *               The buffer is split into ADAC_PACKET_POOL_SIZE packets which are locked
+ *               and released independently by requests and responses.
  *   @param    - ctx            Hook for platform-specific descriptor
  *               buffer         Pointer to memory used for TX/RX
  *               buffer_size    Size of allocated memory for TX/RX
@@ -66,6 +86,15 @@ int pal_msg_interface_free(void *ctx);
 
 int pal_message_send(uint8_t buffer[], size_t size);
 
+/**
+ *   @brief    - Send the concatenation of several buffers to the device as one transfer.
+ *   @param    - vector         Array of buffers to be sent in order
+ *               count          Number of entries in vector
+ *   @return   - 0 on success, PAL_STATUS_UNSUPPORTED_FUNC if the link layer cannot gather
+ *               buffers, negative value on failure
+**/
+int pal_message_send_vector(const pal_msg_vector_t vector[], size_t count);
+
 int pal_message_receive(uint8_t buffer[], size_t size);
 
 #endif /*_PAL_INTERFACES_H_ */
@@ -244,8 +244,68 @@ psa_status_t psa_adac_parse_response(uint32_t command, response_packet_t *packet
     return r;
 }
 
+#ifdef ADAC_PIPELINED_TRANSPORT
+static psa_status_t psa_adac_send_certificate_pipelined(psa_tlv_t **extns_list,
+                                                        size_t extns_count)
+{
+    response_packet_t *response;
+    psa_status_t r, result;
+    uint8_t *payload[ADAC_MAX_INFLIGHT_COMMANDS];
+    size_t payload_size[ADAC_MAX_INFLIGHT_COMMANDS];
+    size_t i, j, pending = 0, sent = 0;
+
+    for (i = 0; i < extns_count; i++) {
+        if (extns_list[i]->type_id == 0x0201) {
+            payload[pending] = (uint8_t *)extns_list[i];
+            payload_size[pending] = extns_list[i]->length_in_bytes + sizeof(psa_tlv_t);
+            pending++;
+        }
+
+        if ((pending == ADAC_MAX_INFLIGHT_COMMANDS) || ((i + 1 == extns_count) && pending)) {
+            PSA_ADAC_LOG_INFO("host", "Sending %d Certificates..\n", (int) pending);
+            if (request_packet_send_batch(SDP_AUTH_RESPONSE_CMD, payload, payload_size,
+                                          pending) < 0)
+                return PSA_ERROR_GENERIC_ERROR;
+
+            /* Responses arrive in the order the requests were sent. After an error the
+               remaining responses are still read and released, so that the next command
+               doesn't receive a stale one */
+            result = PSA_SUCCESS;
+            for (j = 0; j < pending; j++) {
+                response = psa_adac_await_response();
+                r = psa_adac_parse_response(SDP_AUTH_RESPONSE_CMD, response);
+                if (response == NULL)
+                    return r;
+
+                if ((r == PSA_SUCCESS) && (response->status != SDP_NEED_MORE_DATA)) {
+                    PSA_ADAC_LOG_ERR("host", "Unexpected response status %x\n",
+                                     response->status);
+                    r = PSA_ERROR_GENERIC_ERROR;
+                }
+                response_packet_release(response);
+                if (result == PSA_SUCCESS)
+                    result = r;
+            }
+            if (result != PSA_SUCCESS)
+                return result;
+            sent += pending;
+            pending = 0;
+        }
+    }
+
+    if (sent == 0) {
+        PSA_ADAC_LOG_ERR("host", "No certificate found in chain\n");
+        return PSA_ERROR_GENERIC_ERROR;
+    }
+    return PSA_SUCCESS;
+}
+#endif
+
 psa_status_t psa_adac_send_certificate(psa_tlv_t **extns_list, size_t extns_count)
 {
+#ifdef ADAC_PIPELINED_TRANSPORT
+    return psa_adac_send_certificate_pipelined(extns_list, extns_count);
+#else
     request_packet_t *request;
     response_packet_t *response;
     psa_status_t r;
@@ -280,6 +340,7 @@ psa_status_t psa_adac_send_certificate(psa_tlv_t **extns_list, size_t extns_coun
     }
     response_packet_release(response);
     return r;
+#endif
 }
 
 psa_status_t psa_adac_construct_token(uint8_t challenge[], size_t challenge_size,
@@ -22,116 +22,146 @@
 #include <string.h>
 
 enum {
-    BUFFER_UNINITIALIZED = 0,
-    BUFFER_EMPTY,
-    BUFFER_REQUEST,
-    BUFFER_RESPONSE
+    PACKET_FREE = 0,
+    PACKET_REQUEST,
+    PACKET_RESPONSE
 };
-static size_t static_buffer_size;
-static uint8_t *static_buffer_pointer;
-static uint8_t static_buffer_status = BUFFER_UNINITIALIZED;
 
-int static_buffer_msg_init(uint8_t *buffer, size_t size)
+typedef struct {
+    uint8_t *pointer;
+    uint8_t status;
+} packet_slot_t;
+
+static packet_slot_t packet_pool[ADAC_PACKET_POOL_SIZE];
+static size_t packet_size;
+static uint8_t packet_pool_ready;
+
+int packet_pool_init(uint8_t *buffer, size_t size)
 {
-    int ret = -1;
+    size_t i;
+
+    if (packet_pool_ready)
+        return -1;
 
-    if (static_buffer_status == BUFFER_UNINITIALIZED) {
-        static_buffer_size = size;
-        static_buffer_pointer = buffer;
-        static_buffer_status = BUFFER_EMPTY;
-        ret = 0;
+    /* Split the buffer into word aligned packets of equal size */
+    packet_size = (size / ADAC_PACKET_POOL_SIZE) & ~(size_t) 3;
+    if (packet_size <= sizeof(response_packet_t))
+        return -1;
+
+    for (i = 0; i < ADAC_PACKET_POOL_SIZE; i++) {
+        packet_pool[i].pointer = buffer + i * packet_size;
+        packet_pool[i].status = PACKET_FREE;
     }
-    return ret;
+    packet_pool_ready = 1;
+    return 0;
 }
 
-int static_buffer_msg_release(void)
+int packet_pool_release(void)
 {
-    int ret = -1;
+    size_t i;
+
+    if (!packet_pool_ready)
+        return -1;
 
-    if (static_buffer_status == BUFFER_EMPTY) {
-        static_buffer_size = 0;
-        static_buffer_pointer = NULL;
-        static_buffer_status = BUFFER_UNINITIALIZED;
-        ret = 0;
+    for (i = 0; i < ADAC_PACKET_POOL_SIZE; i++) {
+        if (packet_pool[i].status != PACKET_FREE)
+            return -1;
     }
-    return ret;
+
+    for (i = 0; i < ADAC_PACKET_POOL_SIZE; i++)
+        packet_pool[i].pointer = NULL;
+
+    packet_size = 0;
+    packet_pool_ready = 0;
+    return 0;
 }
 
-request_packet_t *request_packet_build(uint16_t command, uint8_t *data, size_t data_size)
+static uint8_t *packet_lock(uint8_t status, size_t *max_data_size)
 {
-    request_packet_t *request = NULL;
+    size_t i;
 
-    if ((static_buffer_status == BUFFER_EMPTY) &&
-        (data_size <= (static_buffer_size - sizeof(request_packet_t)))) {
-        request = (request_packet_t *) static_buffer_pointer;
-        request->command = command;
-        request->data_count = data_size / 4UL;
-        (void) memcpy((void *) request->data, (void *) data, data_size);
-        static_buffer_status = BUFFER_REQUEST;
+    if (!packet_pool_ready)
+        return NULL;
+
+    for (i = 0; i < ADAC_PACKET_POOL_SIZE; i++) {
+        if (packet_pool[i].status == PACKET_FREE) {
+            if (max_data_size != NULL)
+                *max_data_size = packet_size - sizeof(response_packet_t);
+
+            packet_pool[i].status = status;
+            return packet_pool[i].pointer;
+        }
     }
-    return request;
+    return NULL;
 }
 
-request_packet_t *request_packet_lock(size_t *max_data_size)
+static int packet_release(void *packet, uint8_t status)
 {
-    request_packet_t *request = NULL;
+    size_t i;
 
-    if (static_buffer_status == BUFFER_EMPTY) {
-        if (max_data_size != NULL)
-            *max_data_size = static_buffer_size - sizeof(response_packet_t);
+    if (packet == NULL)
+        return -1;
 
-        request = (request_packet_t *) static_buffer_pointer;
-        static_buffer_status = BUFFER_REQUEST;
+    for (i = 0; i < ADAC_PACKET_POOL_SIZE; i++) {
+        if ((packet_pool[i].pointer == (uint8_t *) packet) &&
+            (packet_pool[i].status == status)) {
+            packet_pool[i].status = PACKET_FREE;
+            return 0;
+        }
     }
-    return request;
+    return -1;
 }
 
-int request_packet_release(request_packet_t *packet)
+request_packet_t *request_packet_build(uint16_t command, uint8_t *data, size_t data_size)
 {
-    int ret = -1;
+    request_packet_t *request = NULL;
+    size_t max_data_size;
+
+    request = (request_packet_t *) packet_lock(PACKET_REQUEST, &max_data_size);
+    if (request == NULL)
+        return NULL;
 
-    if (static_buffer_status == BUFFER_REQUEST) {
-        static_buffer_status = BUFFER_EMPTY;
-        ret = 0;
+    if (data_size > max_data_size) {
+        packet_release(request, PACKET_REQUEST);
+        return NULL;
     }
-    return ret;
+
+    request->command = command;
+    request->data_count = data_size / 4UL;
+    (void) memcpy((void *) request->data, (void *) data, data_size);
+    return request;
 }
 
-response_packet_t *response_packet_lock(size_t *max_data_size)
+request_packet_t *request_packet_lock(size_t *max_data_size)
 {
-    response_packet_t *response = NULL;
+    return (request_packet_t *) packet_lock(PACKET_REQUEST, max_data_size);
+}
 
-    if (static_buffer_status == BUFFER_EMPTY) {
-        if (max_data_size != NULL)
-            *max_data_size = static_buffer_size - sizeof(response_packet_t);
+int request_packet_release(request_packet_t *packet)
+{
+    return packet_release(packet, PACKET_REQUEST);
+}
 
-        response = (response_packet_t *) static_buffer_pointer;
-        static_buffer_status = BUFFER_RESPONSE;
-    }
-    return response;
+response_packet_t *response_packet_lock(size_t *max_data_size)
+{
+    return (response_packet_t *) packet_lock(PACKET_RESPONSE, max_data_size);
 }
 
 int response_packet_release(response_packet_t *packet)
 {
-    int ret = -1;
-
-    if (static_buffer_status == BUFFER_RESPONSE) {
-        static_buffer_status = BUFFER_EMPTY;
-        ret = 0;
-    }
-    return ret;
+    return packet_release(packet, PACKET_RESPONSE);
 }
 
 int msg_interface_init(void *ctx, uint8_t buffer[], size_t buffer_size)
 {
     pal_msg_interface_init(ctx);
-    return static_buffer_msg_init(buffer, buffer_size);
+    return packet_pool_init(buffer, buffer_size);
 }
 
 int msg_interface_free(void *ctx)
 {
     pal_msg_interface_free(ctx);
-    return static_buffer_msg_release();
+    return packet_pool_release();
 }
 
 int request_packet_send(request_packet_t *packet)
@@ -145,6 +175,49 @@ int request_packet_send(request_packet_t *packet)
     return pal_message_send((uint8_t *) packet, size);
 }
 
+int request_packet_send_batch(uint16_t command, uint8_t *data[], size_t data_size[],
+                              size_t count)
+{
+    uint32_t header[ADAC_MAX_INFLIGHT_COMMANDS];
+    pal_msg_vector_t vector[2 * ADAC_MAX_INFLIGHT_COMMANDS];
+    request_packet_t *request;
+    size_t i, n = 0;
+    int ret;
+
+    if ((count > ADAC_MAX_INFLIGHT_COMMANDS) || (!packet_pool_ready))
+        return -1;
+
+    for (i = 0; i < count; i++) {
+        if (data_size[i] > (packet_size - sizeof(request_packet_t)))
+            return -1;
+
+        request = (request_packet_t *) &header[i];
+        request->command = command;
+        request->data_count = data_size[i] / 4UL;
+
+        vector[n].base = (uint8_t *) request;
+        vector[n++].size = sizeof(request_packet_t);
+        if (request->data_count) {
+            vector[n].base = data[i];
+            vector[n++].size = 4 * request->data_count;
+        }
+    }
+
+    ret = pal_message_send_vector(vector, n);
+    if (ret != PAL_STATUS_UNSUPPORTED_FUNC)
+        return (ret < 0) ? -1 : 0;
+
+    /* Link layer cannot gather buffers, stage each request in a pool packet */
+    for (i = 0; i < count; i++) {
+        request = request_packet_build(command, data[i], data_size[i]);
+        ret = request_packet_send(request);
+        request_packet_release(request);
+        if (ret < 0)
+            return -1;
+    }
+    return 0;
+}
+
 static int message_receive(uint8_t buffer[], size_t max, size_t *size)
 {
     size_t length;
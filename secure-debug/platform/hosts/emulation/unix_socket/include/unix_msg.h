@@ -20,14 +20,31 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #if !defined(_MSC_VER)
 #include <sys/types.h>
+#include <sys/uio.h>
 #else // !defined(_MSC_VER)
 #include <BaseTsd.h>
 typedef SSIZE_T ssize_t;
+
+struct iovec {
+    void *iov_base;
+    size_t iov_len;
+};
 #endif // !defined(_MSC_VER)
 
+/* Size of the read-ahead buffer used by nread_buffered */
+#define UNIX_MSG_READ_BUFFER_SIZE 4096
+
+typedef struct {
+    int fd;
+    size_t head;
+    size_t tail;
+    uint8_t data[UNIX_MSG_READ_BUFFER_SIZE];
+} unix_msg_reader_t;
+
 bool unix_socket_init(void);
 
 int unix_socket_server(const char *path);
@@ -38,4 +55,9 @@ void unix_socket_close(int fd);
 ssize_t nwrite(int fd, const uint8_t *buf, size_t count);
 ssize_t nread(int fd, uint8_t *buf, size_t count);
 
+ssize_t nwritev(int fd, struct iovec *iov, int iovcnt);
+
+void unix_msg_reader_init(unix_msg_reader_t *reader, int fd);
+ssize_t nread_buffered(unix_msg_reader_t *reader, uint8_t *buf, size_t count);
+
 #endif //PSA_ADAC_UNIX_MSG_H
@@ -20,38 +20,126 @@
 #include "pal_interfaces.h"
 #include "unix_msg.h"
 
+#if !defined(_MSC_VER)
+    #include <unistd.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+#endif // !defined(_MSC_VER)
+
+/* Number of command line arguments describing one target */
+#define TARGET_ARG_COUNT    3
+
 int32_t val_entry(void);
 
+extern uint8_t buffer[ADAC_PACKET_POOL_SIZE * ADAC_PACKET_SIZE];
+uint8_t buffer[ADAC_PACKET_POOL_SIZE * ADAC_PACKET_SIZE];
+char *key_file, *chain_file;
+
 /**
-    @brief    - PSA C main function, used for generating host-side test binaries.
-    @param    - argc    : the number of command line arguments.
-                argv    : array containing command line arguments.
+    @brief    - Runs the test suite against one target in the calling process.
+    @param    - target  : keyfile, chainfile and socket path of the target
     @return   - error status
 **/
-extern uint8_t buffer[4096];
-uint8_t buffer[4096];
-char *key_file, *chain_file;
-
-int main(int argc, char *argv[])
+static int run_target(char *target[])
 {
-    if (argc < 4) {
-        printf("Usage:\n\tpsa_adac_test <keyfile> <chainfile> <socket>\n\n");
-        exit(-1);
-    }
+    int fd, status;
 
-    key_file = argv[1];
-    chain_file = argv[2];
-    char *socket_path = argv[3];
-    int fd;
+    key_file = target[0];
+    chain_file = target[1];
 
-    fd = unix_socket_client(socket_path);
+    fd = unix_socket_client(target[2]);
     if (-1 == fd)
-        exit(-1);
+        return -1;
 
     msg_interface_init((void *) &fd, buffer, sizeof(buffer));
 
-    return val_entry();
+    status = val_entry();
 
     msg_interface_free(NULL);
-    return 0;
+    return status;
+}
+
+#if !defined(_MSC_VER)
+/**
+    @brief    - Runs the test suite against several targets concurrently. Each target gets
+                its own process, so sessions share no state, and its own log file
+                psa_adac_test_<n>.log in the current directory.
+    @param    - count   : number of targets
+                target  : TARGET_ARG_COUNT arguments per target
+    @return   - 0 if all targets passed, -1 otherwise
+**/
+static int run_targets(int count, char *target[])
+{
+    pid_t *pid;
+    char log_file[32];
+    int i, wstatus, failed = 0;
+
+    pid = (pid_t *) calloc(count, sizeof(pid_t));
+    if (pid == NULL)
+        return -1;
+
+    for (i = 0; i < count; i++) {
+        snprintf(log_file, sizeof(log_file), "psa_adac_test_%d.log", i + 1);
+        fflush(stdout);
+
+        pid[i] = fork();
+        if (pid[i] == 0) {
+            if (freopen(log_file, "w", stdout) == NULL)
+                exit(-1);
+            exit(run_target(&target[i * TARGET_ARG_COUNT]) == 0 ? 0 : 1);
+        }
+        if (pid[i] < 0)
+            printf("Could not start session for %s\n", target[i * TARGET_ARG_COUNT + 2]);
+    }
+
+    printf("\n************ ADAC Multi-target Report **********\n");
+    for (i = 0; i < count; i++) {
+        wstatus = -1;
+        if ((pid[i] > 0) && (waitpid(pid[i], &wstatus, 0) != pid[i]))
+            wstatus = -1;
+
+        if ((wstatus != -1) && WIFEXITED(wstatus) && (WEXITSTATUS(wstatus) == 0)) {
+            printf("TARGET %d : PASSED  ", i + 1);
+        } else {
+            printf("TARGET %d : FAILED  ", i + 1);
+            failed++;
+        }
+        printf("(%s, %s) log: psa_adac_test_%d.log\n", target[i * TARGET_ARG_COUNT + 1],
+                                                       target[i * TARGET_ARG_COUNT + 2], i + 1);
+    }
+    printf("TOTAL TARGETS   : %d\n", count);
+    printf("TOTAL PASSED    : %d\n", count - failed);
+    printf("TOTAL FAILED    : %d\n", failed);
+    printf("************************************************\n");
+
+    free(pid);
+    return failed ? -1 : 0;
+}
+#endif // !defined(_MSC_VER)
+
+/**
+    @brief    - PSA C main function, used for generating host-side test binaries.
+    @param    - argc    : the number of command line arguments.
+                argv    : array containing command line arguments.
+    @return   - error status
+**/
+int main(int argc, char *argv[])
+{
+    int count = (argc - 1) / TARGET_ARG_COUNT;
+
+    if ((argc < 4) || (((argc - 1) % TARGET_ARG_COUNT) != 0)) {
+        printf("Usage:\n\tpsa_adac_test <keyfile> <chainfile> <socket> "
+               "[<keyfile> <chainfile> <socket> ...]\n\n");
+        exit(-1);
+    }
+
+    if (count == 1)
+        return run_target(&argv[1]);
+
+#if !defined(_MSC_VER)
+    return run_targets(count, &argv[1]);
+#else
+    printf("Multiple targets are not supported on this host\n");
+    return -1;
+#endif
 }
@@ -31,14 +31,16 @@
     #pragma warning(disable : 4996)
 #endif // !defined(_MSC_VER)
 
-#define PAL_STATUS_UNSUPPORTED_FUNC      0xFF
-
 typedef enum {
     PAL_STATUS_SUCCESS = 0x0,
     PAL_STATUS_ERROR   = 0x80
 } pal_status_t;
 
+/* Maximum number of buffers gathered in one pal_message_send_vector call */
+#define PAL_MSG_MAX_VECTORS     16
+
 static int _fd;
+static unix_msg_reader_t _reader;
 
 int pal_print(const char *str, int32_t data)
 {
@@ -67,6 +69,7 @@ int pal_msg_interface_init(void *ctx)
         return -1;
 
     _fd = *((int *) ctx);
+    unix_msg_reader_init(&_reader, _fd);
     return 0;
 }
 
@@ -82,8 +85,24 @@ int pal_message_send(uint8_t buffer[], size_t size)
     return (nwrite(_fd, (uint8_t *) buffer, size) == size ? 0 : -1);
 }
 
+int pal_message_send_vector(const pal_msg_vector_t vector[], size_t count)
+{
+    struct iovec iov[PAL_MSG_MAX_VECTORS];
+    size_t i, size = 0;
+
+    if (count > PAL_MSG_MAX_VECTORS)
+        return -1;
+
+    for (i = 0; i < count; i++) {
+        iov[i].iov_base = (void *) vector[i].base;
+        iov[i].iov_len = vector[i].size;
+        size += vector[i].size;
+    }
+    return (nwritev(_fd, iov, (int) count) == size ? 0 : -1);
+}
+
 int pal_message_receive(uint8_t buffer[], size_t size)
 {
-    return nread(_fd, buffer, size);
+    return nread_buffered(&_reader, buffer, size);
 }
 
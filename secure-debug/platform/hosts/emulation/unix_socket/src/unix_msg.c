@@ -25,6 +25,7 @@
 #if !defined(_MSC_VER)
     #include <unistd.h>
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <sys/un.h>
 #else // !defined(_MSC_VER)
     #include <WinSock2.h>
@@ -154,3 +155,102 @@ ssize_t nread(int fd, uint8_t *buf, size_t count)
     }
     return count;
 }
+
+/* Writes all the vectors, resuming after partial writes. The vector array is
+ * updated in place as data is consumed. */
+ssize_t nwritev(int fd, struct iovec *iov, int iovcnt)
+{
+    ssize_t t;
+    size_t count = 0;
+
+#if !defined(_MSC_VER)
+    while (iovcnt > 0) {
+        t = writev(fd, iov, iovcnt);
+        if (t < 0)
+            return -1;
+        count += t;
+
+        while ((iovcnt > 0) && ((size_t) t >= iov->iov_len)) {
+            t -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = (char *) iov->iov_base + t;
+            iov->iov_len -= t;
+        }
+    }
+#else
+    for (; iovcnt > 0; iov++, iovcnt--) {
+        t = nwrite(fd, (const uint8_t *) iov->iov_base, iov->iov_len);
+        if (t < 0)
+            return -1;
+        count += t;
+    }
+#endif
+    return count;
+}
+
+void unix_msg_reader_init(unix_msg_reader_t *reader, int fd)
+{
+    reader->fd = fd;
+    reader->head = 0;
+    reader->tail = 0;
+}
+
+/* Reads exactly count bytes. Any data already received past the request is kept
+ * in the reader, so that a header and its body, or several pipelined responses,
+ * are collected with a single system call. */
+ssize_t nread_buffered(unix_msg_reader_t *reader, uint8_t *buf, size_t count)
+{
+    char *ptr = (char *) buf;
+    size_t left = count;
+    size_t chunk;
+    ssize_t t;
+
+    chunk = reader->tail - reader->head;
+    if (chunk > left)
+        chunk = left;
+    memcpy(ptr, reader->data + reader->head, chunk);
+    reader->head += chunk;
+    ptr += chunk;
+    left -= chunk;
+
+    if (reader->head == reader->tail) {
+        reader->head = 0;
+        reader->tail = 0;
+    }
+
+    while (left) {
+#if !defined(_MSC_VER)
+        struct iovec iov[2];
+
+        iov[0].iov_base = ptr;
+        iov[0].iov_len = left;
+        iov[1].iov_base = reader->data;
+        iov[1].iov_len = sizeof(reader->data);
+
+        t = readv(reader->fd, iov, 2);
+        if (t <= 0)
+            return -1;
+
+        if ((size_t) t > left) {
+            reader->tail = t - left;
+            t = left;
+        }
+#else
+        t = recv(reader->fd, (char *) reader->data, sizeof(reader->data), 0);
+        if (t <= 0)
+            return -1;
+
+        reader->tail = t;
+        if ((size_t) t > left)
+            t = left;
+        memcpy(ptr, reader->data, t);
+        reader->head = t;
+#endif
+        ptr += t;
+        left -= t;
+    }
+    return count;
+}
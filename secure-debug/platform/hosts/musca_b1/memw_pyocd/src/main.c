@@ -26,8 +26,8 @@
 
 int32_t val_entry(void);
 
-extern uint8_t buffer[4096];
-uint8_t buffer[4096];
+extern uint8_t buffer[ADAC_PACKET_POOL_SIZE * ADAC_PACKET_SIZE];
+uint8_t buffer[ADAC_PACKET_POOL_SIZE * ADAC_PACKET_SIZE];
 char *key_file, *chain_file;
 
 // Driver code
@@ -36,8 +36,6 @@
 #include <netinet/in.h>
 #include <netdb.h>
 
-#define PAL_STATUS_UNSUPPORTED_FUNC      0xFF
-
 typedef enum {
     PAL_STATUS_SUCCESS = 0x0,
     PAL_STATUS_ERROR   = 0x80
@@ -111,6 +109,12 @@ int pal_message_send(uint8_t buffer[], size_t size)
     return (int)size;
 }
 
+int pal_message_send_vector(const pal_msg_vector_t vector[], size_t count)
+{
+    /* Each request must travel in its own datagram */
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
 int pal_message_receive(uint8_t buffer[], size_t size)
 {
     int n = 0, len = 0;
@@ -29,6 +29,11 @@ void test_entry(val_api_t *val_api)
 {
     psa_status_t ret;
     val_api_t *val = NULL;
+    uint8_t i;
+    request_packet_t *request;
+    response_packet_t *response1 = NULL, *response2 = NULL;
+    psa_auth_challenge_t *challenge1, *challenge2;
+
     val = val_api;
 
     /* test init */
@@ -39,30 +44,21 @@ void test_entry(val_api_t *val_api)
     }
     psa_adac_host_init();
 
-    uint8_t challenge1[CHALLENGE_SIZE], i;
-    uint8_t *vect;
-    request_packet_t *request;
-    response_packet_t *response;
-
     ret = psa_adac_issue_command(SDP_AUTH_START_CMD, request, NULL, 0);
     if (ret != PSA_SUCCESS) {
         val->err_check_set(TEST_CHECKPOINT_NUM(1), VAL_STATUS_WRITE_FAILED);
         goto test_end;
     }
 
-    response = psa_adac_await_response();
-    ret = psa_adac_parse_response(SDP_AUTH_START_CMD, response);
+    response1 = psa_adac_await_response();
+    ret = psa_adac_parse_response(SDP_AUTH_START_CMD, response1);
     if (ret != PSA_SUCCESS) {
         val->err_check_set(TEST_CHECKPOINT_NUM(2), VAL_STATUS_READ_FAILED);
         goto test_end;
     }
 
-    psa_auth_challenge_t *challenge = (psa_auth_challenge_t *) response->data;
-    vect = (challenge->challenge_vector);
-    response_packet_release(response);
-
-    for (i = 0; i < CHALLENGE_SIZE; i++)
-        challenge1[i] = *(vect+i);
+    /* First response is held while the second challenge is requested */
+    challenge1 = (psa_auth_challenge_t *) response1->data;
 
     ret = psa_adac_issue_command(SDP_AUTH_START_CMD, request, NULL, 0);
     if (ret != PSA_SUCCESS) {
@@ -70,18 +66,17 @@ void test_entry(val_api_t *val_api)
         goto test_end;
     }
 
-    response = psa_adac_await_response();
-    ret = psa_adac_parse_response(SDP_AUTH_START_CMD, response);
+    response2 = psa_adac_await_response();
+    ret = psa_adac_parse_response(SDP_AUTH_START_CMD, response2);
     if (ret != PSA_SUCCESS) {
         val->err_check_set(TEST_CHECKPOINT_NUM(4), VAL_STATUS_READ_FAILED);
         goto test_end;
     }
 
-    challenge = (psa_auth_challenge_t *) response->data;
-    response_packet_release(response);
+    challenge2 = (psa_auth_challenge_t *) response2->data;
 
     for (i = 0; i < CHALLENGE_SIZE; i++) {
-        if (challenge1[i] != *(vect+i))
+        if (challenge1->challenge_vector[i] != challenge2->challenge_vector[i])
             break;
     }
 
@@ -93,5 +88,9 @@ void test_entry(val_api_t *val_api)
     }
 
 test_end:
+    /* Held responses must go back to the pool, msg_interface_free refuses to tear
+       it down otherwise. Releasing a NULL packet is a no-op */
+    response_packet_release(response2);
+    response_packet_release(response1);
     val->test_exit();
 }
@@ -120,6 +120,11 @@ int32_t pal_spi_read(addr_t addr, void *data, uint32_t num)
     return PAL_STATUS_ERROR;
 }
 
+int32_t pal_spi_read_multi(const pal_spi_xfer_t *xfer, uint32_t count)
+{
+    return PAL_STATUS_ERROR;
+}
+
 int32_t pal_spi_write(addr_t addr, const void *data, uint32_t num)
 {
     return PAL_STATUS_ERROR;
@@ -166,6 +166,20 @@ int32_t pal_spi_read(addr_t addr, void *data, uint32_t num)
     }
 }
 
+int32_t pal_spi_read_multi(const pal_spi_xfer_t *xfer, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (cmsis_spi->Receive(xfer[i].data, xfer[i].num) != ARM_DRIVER_OK) {
+            return PAL_STATUS_ERROR;
+        }
+        /* Wait for the transfer to complete before queueing the next one */
+        while (cmsis_spi->GetStatus().busy);
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
 int32_t pal_spi_write(addr_t addr, const void *data, uint32_t num)
 {
     (void)addr;
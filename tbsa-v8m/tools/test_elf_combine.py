@@ -1,6 +1,6 @@
 #!/usr/bin/python
 #/** @file
-# * Copyright (c) 2019, Arm Limited or its affiliates. All rights reserved.
+# * Copyright (c) 2019-2022, Arm Limited or its affiliates. All rights reserved.
 # * SPDX-License-Identifier : Apache-2.0
 # *
 # * Licensed under the Apache License, Version 2.0 (the "License");
@@ -19,21 +19,36 @@
 import sys
 import os
 from fnmatch import fnmatch
-import shutil
 import binascii
+import struct
 
-if (len(sys.argv) != 3):
+if ((len(sys.argv) != 3) and ((len(sys.argv) != 4) or (sys.argv[3] != "--compress"))):
 	print("\nPlease provide following inputs")
 	print("\narg1 : <Starting location to find test elfs>")
 	print("\narg2 : <Output filename of test combined binary>")
+	print("\narg3 : [--compress] Store only the LZ4 compressed loadable segments of each ELF")
 	sys.exit(1)
 
 test_elfs_path = sys.argv[1]
 output_file    = sys.argv[2]
+compress       = (len(sys.argv) == 4)
 file_extension = "*secure.elf"
 test_elfs      = []
 offset         = 1024
 
+# Table of contents placed at the head of the combined binary
+toc_marker     = 0x70C070C0
+toc_version    = 1
+toc_header_fmt = "<IIII"	# marker, version, number of entries, END MARKER offset
+toc_entry_fmt  = "<IIII"	# test_id, test header offset, S ELF size, NS ELF size
+test_hdr_size  = 16
+
+# Packed test image, used in place of the ELF with --compress
+packed_magic   = 0x5A534254	# "TBSZ"
+packed_hdr_fmt = "<III"		# magic, entry address, number of segments
+packed_seg_fmt = "<III"		# load address, size, compressed size
+PT_LOAD        = 1
+
 # Gell the list of all test elfs
 for path, subdirs, files in os.walk(test_elfs_path):
 	for name in files:
@@ -47,12 +62,98 @@ if (len(test_elfs) == 0):
 
 test_elfs = sorted(test_elfs)
 
-def test_elf_combine():
+def lz4_compress_block(src):
+	"""
+	Compresses src into a single LZ4 block using greedy matching
+
+	"""
+	out    = bytearray()
+	table  = {}
+	anchor = 0
+	i      = 0
+	# LZ4 block rules: last match starts at least 12 bytes and ends at least
+	# 5 bytes before the end of the input
+	limit  = len(src) - 12
+
+	def emit(literals, offset, match_len):
+		lit_len = len(literals)
+		token   = (min(lit_len, 15) << 4)
+		if offset:
+			token |= min(match_len - 4, 15)
+		out.append(token)
+		if lit_len >= 15:
+			n = lit_len - 15
+			while n >= 255:
+				out.append(255)
+				n -= 255
+			out.append(n)
+		out.extend(literals)
+		if offset:
+			out.extend(struct.pack("<H", offset))
+			if match_len - 4 >= 15:
+				n = match_len - 4 - 15
+				while n >= 255:
+					out.append(255)
+					n -= 255
+				out.append(n)
+
+	while i < limit:
+		key = src[i:i+4]
+		cand = table.get(key)
+		table[key] = i
+		if (cand is not None) and (i - cand <= 0xFFFF):
+			match_len = 4
+			while (i + match_len < len(src) - 5) and (src[cand + match_len] == src[i + match_len]):
+				match_len += 1
+			emit(src[anchor:i], i - cand, match_len)
+			i += match_len
+			anchor = i
+		else:
+			i += 1
+	emit(src[anchor:], 0, 0)
+	return bytes(out)
+
+def test_elf_pack(elf_file):
+	"""
+	Creates the packed image of a test ELF: entry address and the LZ4
+	compressed PT_LOAD segments with their load address
+
+	"""
+	with open(elf_file, "rb") as f:
+		elf = f.read()
+
+	e_entry, e_phoff         = struct.unpack_from("<II", elf, 24)
+	e_phentsize, e_phnum     = struct.unpack_from("<HH", elf, 42)
+	segments = []
+	for i in range(e_phnum):
+		p_type, p_offset, p_vaddr, p_paddr, p_filesz = struct.unpack_from("<IIIII", elf, e_phoff + i * e_phentsize)
+		if (p_type == PT_LOAD) and p_filesz:
+			segments.append((p_paddr, elf[p_offset:p_offset+p_filesz]))
+
+	image = struct.pack(packed_hdr_fmt, packed_magic, e_entry, len(segments))
+	for paddr, segment in segments:
+		block  = lz4_compress_block(segment)
+		image += struct.pack(packed_seg_fmt, paddr, len(segment), len(block))
+		image += block + (b'\0' * (-len(block) % 4))
+	return image
+
+def test_image(elf_file):
+	"""
+	Returns the image of a test ELF as stored in the combined binary
+
+	"""
+	if compress:
+		return test_elf_pack(elf_file)
+	with open(elf_file, "rb") as f:
+		return f.read()
+
+def test_elf_pairs():
 	"""
 	This function goes through the list of available test ELFs
-	Creates output binary file
+	Returns the list of (test_id, secure ELF, non-secure ELF)
 
 	"""
+	pairs   = []
 	elf_num = 0
 	while elf_num < len(test_elfs):
 		test_id_s  = ''
@@ -75,41 +176,85 @@ def test_elf_combine():
 			print("Mismatch in test_id configuration between Secure and Non-secure file respectively for %s and %s" % (test_elfs[elf_num+1], test_elfs[elf_num]))
 			sys.exit(1)
 
-		"""
-		Create output binary file with the below format
-
-		+---------------+             +----------------+
-		| TEST#0 header |-----------> |  START MARKER  |
-		|               |             |----------------|
-		| Test#0 S ELF  |             |   Test#n ID    |
-		|               |             |----------------|
-		| Test#0 NS ELF |             | Test#n S size  |
-		+---------------+             |----------------|
-		| TEST#1 header |             | Test#n NS size |
-		|               |             +----------------+
-		| Test#1 S ELF  |
-		|               |
-		| Test#1 NS ELF |
-		+---------------+
-			|
-			.
-			|
-			.
-		+---------------+
-		| TEST#n header |
-		|               |
-		| Test#n S ELF  |
-		|               |
-		| Test#n NS ELF |
-		+---------------+
-		|  END MARKER   |
-		+---------------+
-
-		"""
-		with open(output_file, "ab") as write_file:
+		pairs.append((test_id_s, test_elfs[elf_num+1], test_elfs[elf_num]))
+		elf_num = elf_num + 2
+	return pairs
+
+def test_elf_combine():
+	"""
+	This function creates the output binary file from the test ELFs
+
+	"""
+	pairs = test_elf_pairs()
+
+	"""
+	Create output binary file with the below format
+
+	+---------------+             +----------------+
+	|  TOC header   |-----------> |   TOC MARKER   |
+	|  TOC entry#0  |             |----------------|
+	|       .       |             |  TOC version   |
+	|  TOC entry#n  |             |----------------|
+	+---------------+             | Num of entries |
+	| TEST#0 header |---+         |----------------|
+	|               |   |         | END MARKER off |
+	| Test#0 S ELF  |   |         +----------------+
+	|               |   |
+	| Test#0 NS ELF |   |         +----------------+
+	+---------------+   +-------> |  START MARKER  |
+	| TEST#1 header |             |----------------|
+	|               |             |   Test#n ID    |
+	| Test#1 S ELF  |             |----------------|
+	|               |             | Test#n S size  |
+	| Test#1 NS ELF |             |----------------|
+	+---------------+             | Test#n NS size |
+		|                     +----------------+
+		.
+		|                     TOC entry#n: Test#n ID, offset of TEST#n header
+		.                     from the start of the file, S size and NS size
+	+---------------+
+	| TEST#n header |
+	|               |
+	| Test#n S ELF  |
+	|               |
+	| Test#n NS ELF |
+	+---------------+
+	|  END MARKER   |
+	+---------------+
+
+	With --compress, each S and NS ELF is replaced by its packed image:
+
+	+----------------+             +----------------+
+	| PACKED MAGIC   |        +--> |  Load address  |
+	|----------------|        |    |----------------|
+	| Entry address  |        |    |      Size      |
+	|----------------|        |    |----------------|
+	| Num segments   |        |    | Compressed size|
+	|----------------|        |    |----------------|
+	| Segment#0      |--------+    | LZ4 block, word|
+	|      .         |             | aligned        |
+	| Segment#n      |             +----------------+
+	+----------------+
+
+	"""
+	toc        = b''
+	images     = []
+	cur_offset = struct.calcsize(toc_header_fmt) + len(pairs) * struct.calcsize(toc_entry_fmt)
+	for test_id, s_elf, ns_elf in pairs:
+		s_image  = test_image(s_elf)
+		ns_image = test_image(ns_elf)
+		images.append((s_image, ns_image))
+		toc += struct.pack(toc_entry_fmt, test_id, cur_offset, len(s_image), len(ns_image))
+		cur_offset += test_hdr_size + len(s_image) + len(ns_image)
+
+	with open(output_file, "wb") as write_file:
+		write_file.write(struct.pack(toc_header_fmt, toc_marker, toc_version, len(pairs), cur_offset))
+		write_file.write(toc)
+
+		for (test_id_s, s_elf, ns_elf), (s_image, ns_image) in zip(pairs, images):
 			# Print details to console
 			print("test_id %04d : %s\t%05d : %s\t%05d" \
-                               %(test_id_s, test_elfs[elf_num+1], os.path.getsize(test_elfs[elf_num+1]), test_elfs[elf_num], os.path.getsize(test_elfs[elf_num])))
+                               %(test_id_s, s_elf, len(s_image), ns_elf, len(ns_image)))
 			# Writing START_MARKER
 			start_marker = "FACEFACE"
 			start_marker = "".join(reversed([start_marker[i:i+2] for i in range(0, len(start_marker), 2)]))
@@ -118,22 +263,17 @@ def test_elf_combine():
 			test_id      = "{:08x}".format(test_id_s)
 			test_id      = "".join(reversed([test_id[i:i+2] for i in range(0, len(test_id), 2)]))
 			write_file.write(binascii.a2b_hex(test_id))
-			# Writing Secure Test ELF Size
-			s_file_size  = "{:08x}".format(os.path.getsize(test_elfs[elf_num+1]))
+			# Writing Secure Test image Size
+			s_file_size  = "{:08x}".format(len(s_image))
 			s_file_size  = "".join(reversed([s_file_size[i:i+2] for i in range(0, len(s_file_size), 2)]))
 			write_file.write(binascii.a2b_hex(s_file_size))
-			# Writing Non-secure Test ELF Size
-			ns_file_size = "{:08x}".format(os.path.getsize(test_elfs[elf_num]))
+			# Writing Non-secure Test image Size
+			ns_file_size = "{:08x}".format(len(ns_image))
 			ns_file_size = "".join(reversed([ns_file_size[i:i+2] for i in range(0, len(ns_file_size), 2)]))
 			write_file.write(binascii.a2b_hex(ns_file_size))
-			with open(test_elfs[elf_num+1], "rb") as read_file:
-				shutil.copyfileobj(read_file, write_file)
-			with open(test_elfs[elf_num], "rb") as read_file:
-				shutil.copyfileobj(read_file, write_file)
-
-		elf_num = elf_num + 2
+			write_file.write(s_image)
+			write_file.write(ns_image)
 
-	with open(output_file, "ab") as write_file:
 		end_marker = "C3C3C3C3"
 		write_file.write(binascii.a2b_hex(end_marker))
 
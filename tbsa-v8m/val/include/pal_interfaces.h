@@ -20,6 +20,12 @@
 
 #include "val_common.h"
 
+typedef struct {
+    addr_t   addr;              /* Address of the region to read */
+    void     *data;             /* Read buffer */
+    uint32_t num;               /* Number of bytes to receive */
+} pal_spi_xfer_t;
+
 /**
     @brief    - Enable Interrupt
     @param    - intr_num: Interrupt number
@@ -136,6 +142,16 @@ int32_t pal_spi_init(addr_t addr);
 **/
 int32_t  pal_spi_read(addr_t addr, void *data, uint32_t num);
 
+/**
+    @brief    - Read several regions using SPI commands as one batch. Transfers are issued
+                back to back, a DMA capable implementation only has to poll for completion
+                before starting the next one.
+    @param    - xfer  : List of regions to read
+                count : Number of entries in xfer
+    @return   - error status
+**/
+int32_t  pal_spi_read_multi(const pal_spi_xfer_t *xfer, uint32_t count);
+
 /**
     @brief    - Write peripheral using SPI commands
     @param    - addr : Address of the peripheral
@@ -34,6 +34,8 @@
 #define TBSA_TEST_INVALID_CFG_ID        0xFFFFFFFFUL
 #define TBSA_S_TEST_ACTIVE              0xAAAAAAAAUL
 #define TBSA_NS_TEST_ACTIVE             0x55555555UL
+#define TBSA_NV_JOURNAL_MARKER          0x4a524e4cUL
+#define TBSA_NV_JOURNAL_RECORDS         8
 
 /* typedef's */
 typedef struct
@@ -52,6 +54,16 @@ typedef struct
     uint32_t res0:8;
 }test_count_t;
 
+/* NV_JOURNAL record */
+typedef struct
+{
+    uint32_t     seq;
+    test_id_t    test_id;
+    test_count_t test_count;
+    uint32_t     toc_index;     /* TOC index of the test following test_id, 0 if unknown */
+    uint32_t     check;
+}tbsa_nv_journal_record_t;
+
 /* enums */
 typedef enum
 {
@@ -83,8 +95,8 @@ typedef enum
 
 typedef enum
 {
-    NV_TEST     = 0x0,
-    NV_TEST_CNT = 0x1,
+    NV_TEST     = 0x0,          /* Unused, superseded by NV_JOURNAL */
+    NV_TEST_CNT = 0x1,          /* Unused, superseded by NV_JOURNAL */
     NV_BOOT     = 0x2,
     NV_DPM1     = 0x3,
     NV_DPM2     = 0x4,
@@ -92,6 +104,7 @@ typedef enum
     NV_SPAD1    = 0x6,
     NV_SPAD2    = 0x7,
     NV_ACT_TST  = 0x8,
+    NV_JOURNAL  = 0x9,          /* TBSA_NV_JOURNAL_RECORDS records from here */
 }nvram_index_t;
 
 /* prototypes */
@@ -113,6 +126,12 @@ char           *val_get_comp_name(test_id_t test_id);
 
 tbsa_status_t  val_get_test_binary_info(addr_t *test_binary_src_addr, uint32_t *test_binary_in_ram);
 
+tbsa_status_t  val_nv_journal_load   (void);
+tbsa_status_t  val_nv_journal_commit (test_id_t test_id, test_count_t *test_count);
+void           val_nv_journal_get    (test_id_t *test_id, test_count_t *test_count);
+uint32_t       val_nv_journal_get_toc_index (void);
+void           val_nv_journal_set_toc_index (uint32_t toc_index);
+
 void           val_memcpy                  (void *dst, void *src, uint32_t size);
 void           val_memset                  (void *dst, uint32_t str,  uint32_t size);
 uint32_t       val_execute_in_trusted_mode (addr_t address);
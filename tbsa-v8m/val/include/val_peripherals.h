@@ -22,12 +22,14 @@
 #include "val_common.h"
 #include "val_target.h"
 #include "val_infra.h"
+#include "pal_interfaces.h"
 
 tbsa_status_t val_i2c_read         (addr_t addr, uint8_t *data, uint32_t len);
 tbsa_status_t val_i2c_write        (addr_t addr, uint8_t *data, uint32_t len);
 
 tbsa_status_t val_spi_init  (void);
 tbsa_status_t val_spi_read  (addr_t addr, uint8_t *data, uint32_t len);
+tbsa_status_t val_spi_read_multi (const pal_spi_xfer_t *xfer, uint32_t count);
 tbsa_status_t val_spi_write (addr_t addr, uint8_t *data, uint32_t len);
 
 tbsa_status_t val_timer_init           (addr_t addr, uint32_t time_us, uint32_t timer_tick_us);
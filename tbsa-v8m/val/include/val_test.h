@@ -24,6 +24,12 @@
 #define TBSA_TEST_INVALID               0xFFFFFFFF
 #define TBSA_TEST_START_MARKER          0xfaceface
 #define TBSA_TEST_END_MARKER            0xc3c3c3c3
+#define TBSA_TEST_TOC_MARKER            0x70c070c0
+#define TBSA_TEST_TOC_VERSION           1
+#define TBSA_TEST_TOC_READ_ENTRIES      8
+#define TBSA_TEST_PACKED_MAGIC          0x5a534254
+#define TBSA_LZ4_STREAM_BUF_SIZE        128
+#define TBSA_ELF_PHDR_BATCH             8
 
 
 #define TEST_CHECKPOINT_1               0xC01
@@ -105,6 +111,22 @@ typedef struct
     uint32_t  ns_elf_size;
 }tbsa_test_header_t;
 
+typedef struct
+{
+    uint32_t  toc_marker;
+    uint32_t  version;
+    uint32_t  num_entries;
+    uint32_t  end_offset;       /* END MARKER offset from the start of the binary */
+}tbsa_test_toc_header_t;
+
+typedef struct
+{
+    test_id_t test_id;
+    uint32_t  offset;           /* Test header offset from the start of the binary */
+    uint32_t  s_elf_size;
+    uint32_t  ns_elf_size;
+}tbsa_test_toc_entry_t;
+
 typedef struct
 {
     uint16_t reserved;
@@ -112,6 +134,20 @@ typedef struct
     uint8_t  status;
 }tbsa_status_buffer_t;
 
+typedef struct
+{
+    uint32_t  magic;            /* TBSA_TEST_PACKED_MAGIC */
+    uint32_t  entry;            /* Test info address */
+    uint32_t  num_segments;
+}tbsa_packed_header_t;
+
+typedef struct
+{
+    uint32_t  paddr;            /* Load address */
+    uint32_t  size;             /* Size once decompressed */
+    uint32_t  packed_size;      /* Size of the LZ4 block following this descriptor */
+}tbsa_packed_segment_t;
+
 typedef struct {
     uint32_t *bss_start;
     uint32_t *bss_end;
@@ -81,7 +81,8 @@ void tbsa_dispatcher(test_id_t test_id_prev)
     {
         status = val_test_load(&test_id, test_id_prev);
         if (test_id == TBSA_TEST_INVALID) {
-            status = val_nvram_write(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST), &test_id, sizeof(test_id_t));
+            val_nv_journal_get(NULL, &test_count);
+            status = val_nv_journal_commit(test_id, &test_count);
             if(status != TBSA_STATUS_SUCCESS) {
                 val_print(PRINT_ALWAYS, "\n\tNVRAM write error", 0);
             }
@@ -127,14 +128,7 @@ void tbsa_dispatcher(test_id_t test_id_prev)
         /* calling NS exit hook unconditionally */
         val_execute_test_fn(test_id, EXIT_FUNC_HOOK_NS);
 
-        status = val_nvram_read(memory_desc->start,
-                                TBSA_NVRAM_OFFSET(NV_TEST_CNT),
-                                &test_count,
-                                sizeof(test_count_t));
-        if(status != TBSA_STATUS_SUCCESS) {
-            val_print(PRINT_ALWAYS, "\n\tNVRAM write error", 0);
-            break;
-        }
+        val_nv_journal_get(NULL, &test_count);
         if (IS_TEST_PASS(val_get_status())) {
             test_count.pass_cnt += 1;
         } else if(IS_TEST_SKIP(val_get_status())) {
@@ -142,10 +136,9 @@ void tbsa_dispatcher(test_id_t test_id_prev)
         } else if(IS_TEST_FAIL(val_get_status())) {
             test_count.fail_cnt += 1;
         }
-        status = val_nvram_write(memory_desc->start,
-                                 TBSA_NVRAM_OFFSET(NV_TEST_CNT),
-                                 &test_count,
-                                 sizeof(test_count_t));
+
+        /* Test ID and summary counters are committed together, in a single NVRAM write */
+        status = val_nv_journal_commit(test_id, &test_count);
         if(status != TBSA_STATUS_SUCCESS) {
             val_print(PRINT_ALWAYS, "\n\tNVRAM write error", 0);
             break;
@@ -155,12 +148,6 @@ void tbsa_dispatcher(test_id_t test_id_prev)
 
         test_id_prev = test_id;
 
-        status = val_nvram_write(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST), &test_id_prev, sizeof(test_id_t));
-        if(status != TBSA_STATUS_SUCCESS) {
-            val_print(PRINT_ALWAYS, "\n\tNVRAM write error", 0);
-            break;
-        }
-
     } while(1);
 
 exit:
@@ -31,6 +31,15 @@ tbsa_status_buffer_t g_test_status_buffer[TBSA_TOTAL_TESTS];
 bool_t               g_vtor_relocated_from_rom;
 addr_t               g_stdio_uart_base_addr = NULL;
 
+/* Dispatcher bookkeeping as last written to NVRAM */
+static struct {
+    uint32_t     seq;
+    uint32_t     slot;
+    test_id_t    test_id;
+    test_count_t test_count;
+    uint32_t     toc_index;
+} g_nv_journal;
+
 /* externs*/
 extern tbsa_isr_vector      g_tbsa_s_isr_vector;
 extern tbsa_isr_vector      g_tbsa_ns_isr_vector;
@@ -229,6 +238,156 @@ tbsa_status_t val_memory_init (void)
     return val_status_buffer_init(&g_test_status_buffer[0]);
 }
 
+/**
+    @brief    - Compute the check word of a journal record
+    @param    - record : Journal record
+    @return   - uint32_t
+**/
+static uint32_t val_nv_journal_check(const tbsa_nv_journal_record_t *record)
+{
+    uint32_t words[4];
+    uint32_t check = TBSA_NV_JOURNAL_MARKER;
+    uint32_t i;
+
+    words[0] = record->seq;
+    words[1] = record->test_id;
+    memcpy(&words[2], &record->test_count, sizeof(test_count_t));
+    words[3] = record->toc_index;
+
+    for (i = 0; i < 4; i++) {
+        check = ((check << 5) | (check >> 27)) ^ words[i];
+    }
+    return check;
+}
+
+/**
+    @brief    - Load the dispatcher bookkeeping from the newest valid NV_JOURNAL record
+    @param    - void
+    @return   - tbsa_status_t
+**/
+tbsa_status_t val_nv_journal_load(void)
+{
+    tbsa_status_t            status;
+    memory_desc_t            *memory_desc;
+    tbsa_nv_journal_record_t records[TBSA_NV_JOURNAL_RECORDS];
+    int32_t                  latest = -1;
+    uint32_t                 i;
+
+    status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, MEMORY_NVRAM, 0),
+                                   (uint8_t **)&memory_desc,
+                                   (uint32_t *)sizeof(memory_desc_t));
+    if(status != TBSA_STATUS_SUCCESS) {
+        return status;
+    }
+
+    status = val_nvram_read(memory_desc->start, TBSA_NVRAM_OFFSET(NV_JOURNAL), records, sizeof(records));
+    if(status != TBSA_STATUS_SUCCESS) {
+        return status;
+    }
+
+    for (i = 0; i < TBSA_NV_JOURNAL_RECORDS; i++) {
+        if (records[i].check != val_nv_journal_check(&records[i])) {
+            continue;
+        }
+        if ((latest < 0) || ((int32_t)(records[i].seq - records[latest].seq) > 0)) {
+            latest = (int32_t)i;
+        }
+    }
+
+    if (latest < 0) {
+        g_nv_journal.seq     = 0;
+        g_nv_journal.slot    = 0;
+        g_nv_journal.test_id = TBSA_TEST_INVALID;
+        memset(&g_nv_journal.test_count, 0, sizeof(test_count_t));
+        g_nv_journal.toc_index = 0;
+    } else {
+        g_nv_journal.seq        = records[latest].seq + 1;
+        g_nv_journal.slot       = ((uint32_t)latest + 1) % TBSA_NV_JOURNAL_RECORDS;
+        g_nv_journal.test_id    = records[latest].test_id;
+        g_nv_journal.test_count = records[latest].test_count;
+        g_nv_journal.toc_index  = records[latest].toc_index;
+    }
+
+    return TBSA_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Write the dispatcher bookkeeping to the next NV_JOURNAL slot
+    @param    - test_id    : Last completed test ID
+              - test_count : Suite summary counters
+    @return   - tbsa_status_t
+**/
+tbsa_status_t val_nv_journal_commit(test_id_t test_id, test_count_t *test_count)
+{
+    tbsa_status_t            status;
+    memory_desc_t            *memory_desc;
+    tbsa_nv_journal_record_t record;
+
+    status = val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, MEMORY_NVRAM, 0),
+                                   (uint8_t **)&memory_desc,
+                                   (uint32_t *)sizeof(memory_desc_t));
+    if(status != TBSA_STATUS_SUCCESS) {
+        return status;
+    }
+
+    record.seq        = g_nv_journal.seq;
+    record.test_id    = test_id;
+    record.test_count = *test_count;
+    record.toc_index  = g_nv_journal.toc_index;
+    record.check      = val_nv_journal_check(&record);
+
+    status = val_nvram_write(memory_desc->start,
+                             TBSA_NVRAM_OFFSET(NV_JOURNAL) + (g_nv_journal.slot * sizeof(record)),
+                             &record,
+                             sizeof(record));
+    if(status != TBSA_STATUS_SUCCESS) {
+        return status;
+    }
+
+    g_nv_journal.seq++;
+    g_nv_journal.slot       = (g_nv_journal.slot + 1) % TBSA_NV_JOURNAL_RECORDS;
+    g_nv_journal.test_id    = test_id;
+    g_nv_journal.test_count = *test_count;
+
+    return TBSA_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Return the dispatcher bookkeeping
+    @param    - test_id    : Last completed test ID, may be NULL
+              - test_count : Suite summary counters, may be NULL
+    @return   - void
+**/
+void val_nv_journal_get(test_id_t *test_id, test_count_t *test_count)
+{
+    if (test_id != NULL) {
+        *test_id = g_nv_journal.test_id;
+    }
+    if (test_count != NULL) {
+        *test_count = g_nv_journal.test_count;
+    }
+}
+
+/**
+    @brief    - Return the TOC position of the test loader
+    @param    - void
+    @return   - TOC index of the test following the last loaded one, 0 if unknown
+**/
+uint32_t val_nv_journal_get_toc_index(void)
+{
+    return g_nv_journal.toc_index;
+}
+
+/**
+    @brief    - Set the TOC position of the test loader, written by the next commit
+    @param    - toc_index : TOC index of the test following the last loaded one
+    @return   - void
+**/
+void val_nv_journal_set_toc_index(uint32_t toc_index)
+{
+    g_nv_journal.toc_index = toc_index;
+}
+
 /**
     @brief    - Initialize NVRAM
     @param    - void
@@ -238,7 +397,6 @@ tbsa_status_t val_nvram_init (void)
 {
     tbsa_status_t  status       = TBSA_STATUS_SUCCESS;
     memory_desc_t  *memory_desc;
-    test_id_t      test_id;
     uint32_t       active_test;
     boot_t         boot;
 
@@ -249,6 +407,11 @@ tbsa_status_t val_nvram_init (void)
         return status;
     }
 
+    status = val_nv_journal_load();
+    if(status != TBSA_STATUS_SUCCESS) {
+        return status;
+    }
+
     status = val_nvram_read(memory_desc->start, TBSA_NVRAM_OFFSET(NV_BOOT), &boot, sizeof(boot_t));
     if(status != TBSA_STATUS_SUCCESS) {
         return status;
@@ -258,11 +421,7 @@ tbsa_status_t val_nvram_init (void)
         (boot.cb != COLD_BOOT_REQUESTED) &&  \
         (boot.wb != WARM_BOOT_REQUESTED) &&  \
         (boot.wdogb != WDOG_BOOT_REQUESTED)) {
-        test_id = TBSA_TEST_INVALID;
-        status = val_nvram_write(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST), &test_id, sizeof(test_id_t));
-        if(status != TBSA_STATUS_SUCCESS) {
-            return status;
-        }
+        /* The journal is restarted by val_nvram_get_last_id as no boot is requested */
         boot.wb    = BOOT_UNKNOWN;
         boot.cb    = BOOT_UNKNOWN;
         boot.wdogb = BOOT_UNKNOWN;
@@ -309,14 +468,10 @@ test_id_t val_nvram_get_last_id (void)
     }
 
     if ((boot.wb == WARM_BOOT_REQUESTED) || (boot.cb == COLD_BOOT_REQUESTED) || (boot.wdogb == WDOG_BOOT_REQUESTED)) {
-        status = val_nvram_read(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST), &test_id, sizeof(test_id_t));
-        if(status != TBSA_STATUS_SUCCESS) {
-            val_print(PRINT_ERROR, "\n\tNVRAM read error", 0);
-            return TBSA_TEST_INVALID;
-        }
+        val_nv_journal_get(&test_id, NULL);
     } else {
         memset((void*)&test_count, 0UL, sizeof(test_count_t));
-        val_nvram_write(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+        val_nv_journal_commit(TBSA_TEST_INVALID, &test_count);
         return TBSA_TEST_INVALID;
     }
 
@@ -427,11 +582,7 @@ tbsa_status_t val_infra_exit(void)
         return status;
     }
 
-    status = val_nvram_read(memory_desc->start, TBSA_NVRAM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
-    if(status != TBSA_STATUS_SUCCESS) {
-        val_print(PRINT_ERROR, "\n\tNVRAM read error", 0);
-        return status;
-    }
+    val_nv_journal_get(NULL, &test_count);
 
     val_print(PRINT_ALWAYS, "\n\r", 0);
     for(int i=3; i < strlen(val_get_comp_name(CREATE_TEST_ID(TBSA_BASE_BASE, 1))); i++) {
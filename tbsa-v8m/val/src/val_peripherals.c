@@ -110,6 +110,26 @@ tbsa_status_t val_spi_read(addr_t addr, uint8_t *data, uint32_t len)
     }
 }
 
+/**
+    @brief    - This API will read several regions via SPI in one batch
+    @param    - xfer  : List of regions to read
+                count : Number of entries in xfer
+    @return   - error status
+**/
+tbsa_status_t val_spi_read_multi(const pal_spi_xfer_t *xfer, uint32_t count)
+{
+    uint32_t i;
+
+    if (g_test_binary_in_ram) {
+        for (i = 0; i < count; i++) {
+            memcpy(xfer[i].data, (void *)xfer[i].addr, xfer[i].num);
+        }
+        return TBSA_STATUS_SUCCESS;
+    } else {
+        return pal_spi_read_multi(xfer, count);
+    }
+}
+
 /**
     @brief    - This API will write to slave address via SPI
     @param    - addr : Slave address
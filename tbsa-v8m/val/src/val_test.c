@@ -1,5 +1,5 @@
 /** @file
- * Copyright (c) 2018-2019, Arm Limited or its affiliates. All rights reserved.
+ * Copyright (c) 2018-2022, Arm Limited or its affiliates. All rights reserved.
  * SPDX-License-Identifier : Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -26,6 +26,9 @@ addr_t          g_s_test_info_addr;
 addr_t          g_ns_test_info_addr;
 extern addr_t   g_test_binary_src_addr;
 extern uint32_t g_test_binary_in_ram;
+/* TOC header of the combined binary, read once per boot */
+static tbsa_test_toc_header_t g_toc_header;
+static uint32_t               g_toc_header_read;
 static const unsigned char elf_magic_header[ELF_IDENT] = {
     0x7f, 0x45, 0x4c, 0x46,     /* 0x7f, 'E', 'L', 'F' */
     0x01,                       /* Only 32-bit objects */
@@ -42,56 +45,326 @@ static const unsigned char elf_magic_header[ELF_IDENT] = {
     0x0
 };
 
+typedef struct {
+    addr_t   addr;                              /* Next byte to fetch */
+    uint32_t left;                              /* Bytes not fetched yet */
+    uint32_t pos;
+    uint32_t len;
+    uint8_t  buf[TBSA_LZ4_STREAM_BUF_SIZE];
+} tbsa_lz4_stream_t;
+
+/**
+    @brief    - This function reads the next bytes of a compressed stream from RAM or SPI.
+                Reads larger than the stream buffer go straight to the destination.
+    @param    - stream : Compressed stream
+              - data   : Destination
+              - len    : Number of bytes to read
+    @return   - tbsa_status_t
+**/
+static tbsa_status_t val_lz4_stream_read(tbsa_lz4_stream_t *stream, uint8_t *data, uint32_t len)
+{
+    uint32_t chunk;
+
+    while (len) {
+        if (stream->pos == stream->len) {
+            if (len > stream->left) {
+                return TBSA_STATUS_LOAD_ERROR;
+            }
+
+            chunk = (len >= sizeof(stream->buf)) ? len :
+                    ((stream->left < sizeof(stream->buf)) ? stream->left : sizeof(stream->buf));
+            if (val_spi_read(stream->addr, (len >= sizeof(stream->buf)) ? data : stream->buf, chunk)) {
+                return TBSA_STATUS_LOAD_ERROR;
+            }
+            stream->addr += chunk;
+            stream->left -= chunk;
+
+            if (len >= sizeof(stream->buf)) {
+                return TBSA_STATUS_SUCCESS;
+            }
+            stream->pos = 0;
+            stream->len = chunk;
+        }
+
+        chunk = stream->len - stream->pos;
+        if (chunk > len) {
+            chunk = len;
+        }
+        memcpy(data, &stream->buf[stream->pos], chunk);
+        stream->pos += chunk;
+        data        += chunk;
+        len         -= chunk;
+    }
+
+    return TBSA_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - This function reads the extension bytes of an LZ4 literal or match length.
+    @param    - stream : Compressed stream
+              - len    : Length to be extended
+    @return   - tbsa_status_t
+**/
+static tbsa_status_t val_lz4_read_length(tbsa_lz4_stream_t *stream, uint32_t *len)
+{
+    uint8_t byte;
+
+    do {
+        if (val_lz4_stream_read(stream, &byte, 1)) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        *len += byte;
+    } while (byte == 0xFF);
+
+    return TBSA_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - This function decompresses an LZ4 block straight into its load address.
+    @param    - saddr       : Location of the LZ4 block
+              - packed_size : Size of the LZ4 block
+              - daddr       : Load address
+              - size        : Expected decompressed size
+    @return   - tbsa_status_t
+**/
+static tbsa_status_t val_lz4_decompress(addr_t saddr, uint32_t packed_size, uint8_t *daddr, uint32_t size)
+{
+    tbsa_lz4_stream_t stream;
+    uint8_t           token, offset[2];
+    uint32_t          len, distance, out = 0;
+
+    stream.addr = saddr;
+    stream.left = packed_size;
+    stream.pos  = 0;
+    stream.len  = 0;
+
+    while (1) {
+        if (val_lz4_stream_read(&stream, &token, 1)) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+
+        /* Literals */
+        len = token >> 4;
+        if ((len == 0xF) && val_lz4_read_length(&stream, &len)) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        if ((len > (size - out)) || val_lz4_stream_read(&stream, &daddr[out], len)) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        out += len;
+
+        /* The last sequence carries literals only */
+        if ((stream.left == 0) && (stream.pos == stream.len)) {
+            break;
+        }
+
+        /* Match copied from already decompressed data */
+        if (val_lz4_stream_read(&stream, offset, sizeof(offset))) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        distance = offset[0] | ((uint32_t)offset[1] << 8);
+        len = token & 0xF;
+        if ((len == 0xF) && val_lz4_read_length(&stream, &len)) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        len += 4;
+        if ((distance == 0) || (distance > out) || (len > (size - out))) {
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        for (; len; len--, out++) {
+            daddr[out] = daddr[out - distance];
+        }
+    }
+
+    return (out == size) ? TBSA_STATUS_SUCCESS : TBSA_STATUS_LOAD_ERROR;
+}
+
+/**
+    @brief    - This function loads a packed test image generated by test_elf_combine.py --compress.
+                Each segment is decompressed straight to its load address.
+    @param    - saddr     : Location of the packed image
+              - info_addr : Populates the entry address(test info address)
+    @return   - tbsa_status_t
+**/
+static tbsa_status_t val_test_packed_load(addr_t saddr, addr_t *info_addr)
+{
+    tbsa_packed_header_t  header;
+    tbsa_packed_segment_t segment;
+    uint32_t              i;
+
+    if (val_spi_read(saddr, (uint8_t *)&header, sizeof(tbsa_packed_header_t))) {
+        val_print(PRINT_ERROR, "Error: reading packed Test header\n", 0);
+        return TBSA_STATUS_LOAD_ERROR;
+    }
+    saddr += sizeof(tbsa_packed_header_t);
+
+    for (i = 0; i < header.num_segments; i++) {
+        if (val_spi_read(saddr, (uint8_t *)&segment, sizeof(tbsa_packed_segment_t))) {
+            val_print(PRINT_ERROR, "Error: reading packed Test segment\n", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        saddr += sizeof(tbsa_packed_segment_t);
+
+        if (val_lz4_decompress(saddr, segment.packed_size, (uint8_t *)segment.paddr, segment.size)) {
+            val_print(PRINT_ERROR, "Error: decompressing Test program\n", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        saddr += (segment.packed_size + 3UL) & ~3UL;
+    }
+
+    *info_addr = (addr_t)header.entry;
+
+    return TBSA_STATUS_SUCCESS;
+}
+
 /**
     @brief    - This function parses ELF header, entry address(test info address) and program headers.
-                Copies the loadable segments to system memory.
+                Copies the loadable segments to system memory. Program headers are fetched
+                TBSA_ELF_PHDR_BATCH at a time and the segments they describe are loaded with a
+                single batched SPI read.
     @param    - saddr              : Source location of tbsa_test_combined.bin
               - info_addr          : Populates the entry address from S/NS test ELF
-              - test_binary_in_ram : 1 - if present in RAM, 0 - otherwise
     @return   - tbsa_status_t
 **/
-static tbsa_status_t val_test_elf_load(addr_t saddr, addr_t *info_addr, uint32_t test_binary_in_ram)
+static tbsa_status_t val_test_elf_load(addr_t saddr, addr_t *info_addr)
 {
     tbsa_elf_header_t test_elfh;
-    tbsa_pheader_t    test_ph;
-    int               i;
-
-    if (test_binary_in_ram == 1UL) {
-        memcpy(&test_elfh, (void*)saddr, sizeof(tbsa_elf_header_t));
-    } else {
-        if (0 != pal_spi_read (saddr, (uint8_t *)&test_elfh, sizeof(tbsa_elf_header_t))) {
-            val_print(PRINT_ERROR, "Error: SPI read failure for Test ELF header\n", 0);
-            return TBSA_STATUS_LOAD_ERROR;
-        }
+    tbsa_pheader_t    test_ph[TBSA_ELF_PHDR_BATCH];
+    pal_spi_xfer_t    xfer[TBSA_ELF_PHDR_BATCH];
+    uint32_t          i, batch, count;
+    uint32_t          nxfer;
+
+    if (val_spi_read(saddr, (uint8_t *)&test_elfh, sizeof(tbsa_elf_header_t))) {
+        val_print(PRINT_ERROR, "Error: SPI read failure for Test ELF header\n", 0);
+        return TBSA_STATUS_LOAD_ERROR;
+    }
+    /* Image packed by test_elf_combine.py --compress */
+    if (*(uint32_t *)test_elfh.e_ident == TBSA_TEST_PACKED_MAGIC) {
+        return val_test_packed_load(saddr, info_addr);
     }
+
     /* validate ELF header */
     if (0 != memcmp(&test_elfh.e_ident, &elf_magic_header, ELF_IDENT)) {
         val_print(PRINT_ERROR, "Fail: Test ELF header validation\n", 0);
         return TBSA_STATUS_INCORRECT_VALUE;
     }
 
-    for(i=0; i < test_elfh.e_phnum; i++) {
-        /* Read the program header */
-        if (test_binary_in_ram == 1UL) {
-            memcpy(&test_ph, (const void*)(saddr + test_elfh.e_phoff + (sizeof(tbsa_pheader_t)*i)), sizeof(tbsa_pheader_t));
-        } else {
-            if (0 != pal_spi_read ((saddr + test_elfh.e_phoff + (sizeof(tbsa_pheader_t)*i)), (uint8_t *)&test_ph, sizeof(tbsa_pheader_t))) {
-                val_print(PRINT_ERROR, "Error: reading Test program header\n", 0);
+    for (batch = 0; batch < test_elfh.e_phnum; batch += count) {
+        count = test_elfh.e_phnum - batch;
+        if (count > TBSA_ELF_PHDR_BATCH) {
+            count = TBSA_ELF_PHDR_BATCH;
+        }
+
+        /* Read the program headers, they are contiguous in the ELF */
+        if (val_spi_read(saddr + test_elfh.e_phoff + (sizeof(tbsa_pheader_t) * batch),
+                         (uint8_t *)test_ph, sizeof(tbsa_pheader_t) * count)) {
+            val_print(PRINT_ERROR, "Error: reading Test program header\n", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+
+        /* Load the programs to physical RAM */
+        nxfer = 0;
+        for (i = 0; i < count; i++) {
+            if (test_ph[i].p_filesz == 0) {
+                continue;
+            }
+            xfer[nxfer].addr = saddr + test_ph[i].p_offset;
+            xfer[nxfer].data = (void *)test_ph[i].p_paddr;
+            xfer[nxfer].num  = test_ph[i].p_filesz;
+            nxfer++;
+        }
+        if (nxfer && val_spi_read_multi(xfer, nxfer)) {
+            val_print(PRINT_ERROR, "Error: loading Test program\n", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+    }
+
+    *info_addr = (addr_t)test_elfh.e_entry;
+
+    return TBSA_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - This function finds the test following test_id_prev using the table of contents
+                at the head of tbsa_test_combined.bin. The TOC entry carries the test ID and
+                the ELF sizes, so the test header itself is not read.
+    @param    - toc          : TOC header of the combined binary
+              - test_id_prev : Previous test ID, TBSA_TEST_INVALID for the first test
+              - saddr        : Returns the address of the next test header
+              - test_header  : Returns the next test header, or an END MARKER if no test is left
+    @return   - tbsa_status_t
+**/
+static tbsa_status_t val_test_toc_lookup(tbsa_test_toc_header_t *toc, test_id_t test_id_prev,
+                                         addr_t *saddr, tbsa_test_header_t *test_header)
+{
+    tbsa_test_toc_entry_t entry[TBSA_TEST_TOC_READ_ENTRIES];
+    addr_t                toc_addr = g_test_binary_src_addr + sizeof(tbsa_test_toc_header_t);
+    uint32_t              next = val_nv_journal_get_toc_index();
+    uint32_t              index = 0, found = 0, i, j, num;
+
+    if (test_id_prev != TBSA_TEST_INVALID) {
+        /* Previous test is usually the last one loaded, also across a reset as the position
+           is kept in the NV journal. Its entry and the next one are contiguous, so one read
+           both checks the position and gives the next test */
+        if ((next > 0) && (next <= toc->num_entries)) {
+            num = (next < toc->num_entries) ? 2 : 1;
+            if (val_spi_read(toc_addr + ((next - 1) * sizeof(tbsa_test_toc_entry_t)),
+                             (uint8_t *)entry, num * sizeof(tbsa_test_toc_entry_t))) {
                 return TBSA_STATUS_LOAD_ERROR;
             }
+            if (entry[0].test_id == test_id_prev) {
+                index = next;
+                found = 1;
+                if (num == 2) {
+                    entry[0] = entry[1];
+                    goto entry_found;
+                }
+            }
         }
-        /* Load the program to physical RAM */
-        if (test_binary_in_ram == 1UL) {
-            memcpy((void*)test_ph.p_paddr, (const void*)(saddr + test_ph.p_offset), test_ph.p_filesz);
-        } else {
-            if (0 != pal_spi_read ((saddr + test_ph.p_offset), (uint8_t *)test_ph.p_paddr, test_ph.p_filesz)) {
-                val_print(PRINT_ERROR, "Error: loading Test program\n", 0);
+
+        /* Otherwise search the TOC, a block of entries per read */
+        for (i = 0; (!found) && (i < toc->num_entries); i += num) {
+            num = toc->num_entries - i;
+            if (num > TBSA_TEST_TOC_READ_ENTRIES) {
+                num = TBSA_TEST_TOC_READ_ENTRIES;
+            }
+            if (val_spi_read(toc_addr + (i * sizeof(tbsa_test_toc_entry_t)),
+                             (uint8_t *)entry, num * sizeof(tbsa_test_toc_entry_t))) {
                 return TBSA_STATUS_LOAD_ERROR;
             }
+            for (j = 0; j < num; j++) {
+                if (entry[j].test_id == test_id_prev) {
+                    index = i + j + 1;
+                    found = 1;
+                    break;
+                }
+            }
+        }
+
+        if (!found) {
+            index = toc->num_entries;
         }
     }
 
-    *info_addr = (addr_t)test_elfh.e_entry;
+    if (index >= toc->num_entries) {
+        *saddr = g_test_binary_src_addr + toc->end_offset;
+        test_header->start_marker = TBSA_TEST_END_MARKER;
+        val_nv_journal_set_toc_index(0);
+        return TBSA_STATUS_SUCCESS;
+    }
+
+    if (val_spi_read(toc_addr + (index * sizeof(tbsa_test_toc_entry_t)),
+                     (uint8_t *)&entry[0], sizeof(tbsa_test_toc_entry_t))) {
+        return TBSA_STATUS_LOAD_ERROR;
+    }
+
+entry_found:
+    *saddr                    = g_test_binary_src_addr + entry[0].offset;
+    test_header->start_marker = TBSA_TEST_START_MARKER;
+    test_header->test_id      = entry[0].test_id;
+    test_header->s_elf_size   = entry[0].s_elf_size;
+    test_header->ns_elf_size  = entry[0].ns_elf_size;
+    val_nv_journal_set_toc_index(index + 1);
 
     return TBSA_STATUS_SUCCESS;
 }
@@ -105,8 +378,8 @@ static tbsa_status_t val_test_elf_load(addr_t saddr, addr_t *info_addr, uint32_t
 **/
 tbsa_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 {
-    tbsa_test_header_t test_header;
-    addr_t             sflash_addr = g_test_binary_src_addr;
+    tbsa_test_header_t     test_header;
+    addr_t                 sflash_addr = g_test_binary_src_addr;
 
     /*
        The combined Test ELF binary:
@@ -136,9 +409,31 @@ tbsa_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
        +---------------+
        |  END MARKER   |
        +---------------+
+
+       tools/test_elf_combine.py prepends a table of contents giving the offset, ID and
+       ELF sizes of each test, so the next test is reached with a single TOC read instead
+       of walking the previous ELFs. Binaries without a TOC are scanned header by header.
      */
 
-    if (test_id_prev != TBSA_TEST_INVALID) {
+    if (!g_toc_header_read) {
+        if (val_spi_read(sflash_addr, (uint8_t *)&g_toc_header, sizeof(tbsa_test_toc_header_t))) {
+            val_print(PRINT_INFO, "\n\n\rError: reading Test binary TOC header", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        g_toc_header_read = 1;
+    }
+
+    if (g_toc_header.toc_marker == TBSA_TEST_TOC_MARKER) {
+        if (g_toc_header.version != TBSA_TEST_TOC_VERSION) {
+            val_print(PRINT_ERROR, "\n\n\rUnsupported Test binary TOC version %d", g_toc_header.version);
+            *test_id = TBSA_TEST_INVALID;
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+        if (val_test_toc_lookup(&g_toc_header, test_id_prev, &sflash_addr, &test_header)) {
+            val_print(PRINT_INFO, "\n\n\rError: reading Test binary TOC", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
+    } else if (test_id_prev != TBSA_TEST_INVALID) {
         /* Reading TBSA header */
         do
         {
@@ -167,9 +462,12 @@ tbsa_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
         }while(1);
     }
 
-    if (val_spi_read(sflash_addr, (uint8_t *)&test_header, sizeof(tbsa_test_header_t))) {
-        val_print(PRINT_INFO, "\n\n\rError: reading custom Test header", 0);
-        return TBSA_STATUS_LOAD_ERROR;
+    /* With a TOC the header fields come from the TOC entry */
+    if (g_toc_header.toc_marker != TBSA_TEST_TOC_MARKER) {
+        if (val_spi_read(sflash_addr, (uint8_t *)&test_header, sizeof(tbsa_test_header_t))) {
+            val_print(PRINT_INFO, "\n\n\rError: reading custom Test header", 0);
+            return TBSA_STATUS_LOAD_ERROR;
+        }
     }
 
     if (test_header.start_marker == TBSA_TEST_END_MARKER) {
@@ -186,14 +484,14 @@ tbsa_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 
     /* load S image */
     sflash_addr += sizeof(tbsa_test_header_t);
-    if (val_test_elf_load(sflash_addr, &g_s_test_info_addr, g_test_binary_in_ram)) {
+    if (val_test_elf_load(sflash_addr, &g_s_test_info_addr)) {
         val_print(PRINT_INFO, "\n\rError: loading Test ELF", 0);
         return TBSA_STATUS_LOAD_ERROR;
     }
 
     /* load NS image */
     sflash_addr += test_header.s_elf_size;
-    if (val_test_elf_load(sflash_addr, &g_ns_test_info_addr, g_test_binary_in_ram)) {
+    if (val_test_elf_load(sflash_addr, &g_ns_test_info_addr)) {
         val_print(PRINT_INFO, "\n\rError: loading Test ELF", 0);
         return TBSA_STATUS_LOAD_ERROR;
     }